@@ -0,0 +1,233 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Assets/NDICustomTimeStep.h>
+
+#include <HAL/PlatformTime.h>
+
+
+UNDICustomTimeStep::UNDICustomTimeStep(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{}
+
+FFrameRate UNDICustomTimeStep::GetFixedFrameRate() const
+{
+	// Use the rate of the source once we have seen it, otherwise whatever the user configured
+	if (SourceFrameRate.IsValid() && (SourceFrameRate.Numerator > 0))
+		return SourceFrameRate;
+
+	return FallbackFrameRate;
+}
+
+bool UNDICustomTimeStep::Initialize(UEngine* InEngine)
+{
+	this->State = ECustomTimeStepSynchronizationState::Closed;
+
+	if (!IsValid(this->NDIMediaSource))
+	{
+		this->State = ECustomTimeStepSynchronizationState::Error;
+		return false;
+	}
+
+	this->NDIMediaSource->Initialize(UNDIMediaReceiver::EUsage::Standalone);
+
+	this->ConnectedEventHandle = this->NDIMediaSource->OnNDIReceiverConnectedEvent.AddLambda([this](UNDIMediaReceiver* Receiver)
+	{
+		if (this->State == ECustomTimeStepSynchronizationState::Closed)
+			this->State = ECustomTimeStepSynchronizationState::Synchronizing;
+	});
+	this->DisconnectedEventHandle = this->NDIMediaSource->OnNDIReceiverDisconnectedEvent.AddLambda([this](UNDIMediaReceiver* Receiver)
+	{
+		OnDropout();
+	});
+
+	this->State = ECustomTimeStepSynchronizationState::Synchronizing;
+
+	this->SourceFrameRate = FFrameRate(0, 1);
+	this->bIsLastSyncDataValid = false;
+	this->LastSyncCountDelta = 1;
+	this->LastWaitEndTime = FPlatformTime::Seconds();
+
+	ResetStatistics();
+
+	return true;
+}
+
+void UNDICustomTimeStep::Shutdown(UEngine* InEngine)
+{
+	ReleaseResources();
+}
+
+bool UNDICustomTimeStep::UpdateTimeStep(UEngine* InEngine)
+{
+	if ((this->State != ECustomTimeStepSynchronizationState::Synchronized) &&
+		(this->State != ECustomTimeStepSynchronizationState::Synchronizing))
+	{
+		// Let the engine tick at its own rate
+		return true;
+	}
+
+	UpdateApplicationLastTime();
+
+	const double TimeBeforeSync = FPlatformTime::Seconds();
+	const bool bSynced = WaitForSync();
+	const double TimeAfterSync = FPlatformTime::Seconds();
+
+	if (!bSynced && !bKeepSourceRateOnDropout)
+	{
+		// We didn't wait for anything, so let the engine pace itself until the source comes back
+		return true;
+	}
+
+	UpdateAppTimes(TimeBeforeSync, TimeAfterSync);
+
+	return false;
+}
+
+ECustomTimeStepSynchronizationState UNDICustomTimeStep::GetSynchronizationState() const
+{
+	if (!IsValid(this->NDIMediaSource))
+		return ECustomTimeStepSynchronizationState::Closed;
+
+	return this->State;
+}
+
+uint32 UNDICustomTimeStep::GetLastSyncCountDelta() const
+{
+	return this->LastSyncCountDelta;
+}
+
+bool UNDICustomTimeStep::IsLastSyncDataValid() const
+{
+	return this->bIsLastSyncDataValid;
+}
+
+/**
+	Blocks until a new video frame arrives from the source, or until the source is considered to have dropped out.
+	While the source is missing, the wait is limited to a single frame period so that the engine keeps ticking
+	at the last known source rate.
+*/
+bool UNDICustomTimeStep::WaitForSync()
+{
+	if (!IsValid(this->NDIMediaSource))
+		return false;
+
+	const double FramePeriod = GetFixedFrameRate().AsInterval();
+	const double WaitStartTime = FPlatformTime::Seconds();
+
+	double Deadline = WaitStartTime;
+	if (this->State == ECustomTimeStepSynchronizationState::Synchronized)
+		Deadline = WaitStartTime + FramePeriod * DropoutTimeout;
+	else if (bKeepSourceRateOnDropout)
+		Deadline = FMath::Max(WaitStartTime, this->LastWaitEndTime + FramePeriod);
+
+	int64 Timestamp = 0;
+	FFrameRate Rate;
+
+	// Only a frame which differs from the one we synced to last counts as an arrival, the frame-sync
+	// keeps handing out the last frame while the source is missing
+	const bool bSynced = this->NDIMediaSource->WaitForConnectedVideo(this->LastSyncTimestamp, Deadline - WaitStartTime, Timestamp, Rate);
+	if (bSynced)
+		OnFrameArrived(Timestamp, Rate, FPlatformTime::Seconds());
+
+	if (!bSynced && (this->State == ECustomTimeStepSynchronizationState::Synchronized))
+		OnDropout();
+
+	this->LastWaitEndTime = FPlatformTime::Seconds();
+
+	return bSynced;
+}
+
+void UNDICustomTimeStep::OnFrameArrived(int64 Timestamp, const FFrameRate& Rate, double ArrivalTime)
+{
+	if (Rate.IsValid() && (Rate.Numerator > 0))
+		this->SourceFrameRate = Rate;
+
+	const double FramePeriod = GetFixedFrameRate().AsInterval();
+
+	if (this->bIsLastSyncDataValid)
+	{
+		// Timestamps are in 100ns intervals
+		const double SourceInterval = (Timestamp - this->LastSyncTimestamp) / 1e+7;
+		const double LocalInterval = ArrivalTime - this->LastSyncTime;
+
+		this->LastSyncCountDelta = (uint32)FMath::Max<int64>(1, FMath::RoundToInt64(SourceInterval / FramePeriod));
+		this->MissedFrames += this->LastSyncCountDelta - 1;
+
+		const float IntervalError = (float)FMath::Abs(LocalInterval - SourceInterval) * 1000.f;
+		this->AverageIntervalError += (IntervalError - this->AverageIntervalError) / (float)(this->SyncedFrames + 1);
+		this->MaximumIntervalError = FMath::Max(this->MaximumIntervalError, IntervalError);
+
+		const double SourceElapsed = (Timestamp - this->LockSourceTimestamp) / 1e+7;
+		const double LocalElapsed = ArrivalTime - this->LockTime;
+		this->Drift = (float)((LocalElapsed - SourceElapsed) * 1000.0);
+	}
+	else
+	{
+		// (Re-)locking to the source, start measuring drift from here
+		this->LastSyncCountDelta = 1;
+		this->LockSourceTimestamp = Timestamp;
+		this->LockTime = ArrivalTime;
+		this->Drift = 0.f;
+	}
+
+	++this->SyncedFrames;
+
+	this->LastSyncTimestamp = Timestamp;
+	this->LastSyncTime = ArrivalTime;
+	this->bIsLastSyncDataValid = true;
+
+	this->State = ECustomTimeStepSynchronizationState::Synchronized;
+}
+
+void UNDICustomTimeStep::OnDropout()
+{
+	if (this->State == ECustomTimeStepSynchronizationState::Synchronized)
+	{
+		++this->Dropouts;
+		this->State = ECustomTimeStepSynchronizationState::Synchronizing;
+	}
+
+	// The next frame we see will re-lock the engine to the source
+	this->bIsLastSyncDataValid = false;
+	this->LastSyncCountDelta = 1;
+}
+
+void UNDICustomTimeStep::ResetStatistics()
+{
+	this->SyncedFrames = 0;
+	this->MissedFrames = 0;
+	this->Dropouts = 0;
+	this->AverageIntervalError = 0.f;
+	this->MaximumIntervalError = 0.f;
+	this->Drift = 0.f;
+
+	this->LockSourceTimestamp = this->LastSyncTimestamp;
+	this->LockTime = this->LastSyncTime;
+}
+
+
+void UNDICustomTimeStep::BeginDestroy()
+{
+	ReleaseResources();
+
+	Super::BeginDestroy();
+}
+
+void UNDICustomTimeStep::ReleaseResources()
+{
+	if(IsValid(this->NDIMediaSource))
+	{
+		this->NDIMediaSource->OnNDIReceiverConnectedEvent.Remove(this->ConnectedEventHandle);
+		this->NDIMediaSource->OnNDIReceiverDisconnectedEvent.Remove(this->DisconnectedEventHandle);
+	}
+	this->ConnectedEventHandle.Reset();
+	this->DisconnectedEventHandle.Reset();
+
+	this->bIsLastSyncDataValid = false;
+	this->State = ECustomTimeStepSynchronizationState::Closed;
+}
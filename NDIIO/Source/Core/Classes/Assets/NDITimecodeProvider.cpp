@@ -14,59 +14,109 @@ UNDITimecodeProvider::UNDITimecodeProvider(const FObjectInitializer& ObjectIniti
 
 bool UNDITimecodeProvider::FetchTimecode(FQualifiedFrameTime& OutFrameTime)
 {
-	FScopeLock Lock(&this->StateSyncContext);
+	if (!IsValid(this->NDIMediaSource))
+		return false;
 
-	if (!IsValid(this->NDIMediaSource) ||
-	    (GetSynchronizationState() != ETimecodeProviderSynchronizationState::Synchronized))
-	{
+	const FTimecodeSnapshot Current = ReadSnapshot();
+	if (Current.State != ETimecodeProviderSynchronizationState::Synchronized)
 		return false;
-	}
 
-	OutFrameTime = this->MostRecentFrameTime;
+	const double Elapsed = FPlatformTime::Seconds() - Current.ArrivalTime;
+	if ((this->StallTimeout > 0.f) && (Elapsed > this->StallTimeout))
+		return false;
+
+	OutFrameTime = Current.FrameTime;
+
+	if (this->bExtrapolateTimecode && (Current.FrameInterval > 0.0) && (Elapsed > 0.0))
+	{
+		// Stay short of the next frame, so that the timecode does not go back when it arrives late
+		const double Frames = FMath::Min(Elapsed / Current.FrameInterval, 0.999);
+		OutFrameTime.Time = Current.FrameTime.Time + FFrameTime::FromDecimal(Frames);
+	}
 
 	return true;
 }
 
 ETimecodeProviderSynchronizationState UNDITimecodeProvider::GetSynchronizationState() const
 {
-	FScopeLock Lock(&this->StateSyncContext);
-
 	if (!IsValid(this->NDIMediaSource))
 		return ETimecodeProviderSynchronizationState::Closed;
 
-	return this->State;
+	const FTimecodeSnapshot Current = ReadSnapshot();
+
+	// A stalled source is synchronizing again, until frames are received
+	if ((Current.State == ETimecodeProviderSynchronizationState::Synchronized) && (this->StallTimeout > 0.f) &&
+	    ((FPlatformTime::Seconds() - Current.ArrivalTime) > this->StallTimeout))
+	{
+		return ETimecodeProviderSynchronizationState::Synchronizing;
+	}
+
+	return Current.State;
 }
 
 bool UNDITimecodeProvider::Initialize(UEngine* InEngine)
 {
-	this->State = ETimecodeProviderSynchronizationState::Closed;
+	FTimecodeSnapshot Initial;
 
 	if (!IsValid(this->NDIMediaSource))
 	{
-		this->State = ETimecodeProviderSynchronizationState::Error;
+		Initial.State = ETimecodeProviderSynchronizationState::Error;
+		PublishSnapshot(Initial);
 		return false;
 	}
 
+	PublishSnapshot(Initial);
+
 	this->NDIMediaSource->Initialize(UNDIMediaReceiver::EUsage::Standalone);
 
 	this->VideoCaptureEventHandle = this->NDIMediaSource->OnNDIReceiverVideoCaptureEvent.AddLambda([this](UNDIMediaReceiver* Receiver, const NDIlib_video_frame_v2_t& VideoFrame)
 	{
+		const double ArrivalTime = FPlatformTime::Seconds();
 		const FFrameRate Rate = Receiver->GetCurrentFrameRate();
 		const FTimecode Timecode = Receiver->GetCurrentTimecode();
 
 		FScopeLock Lock(&this->StateSyncContext);
-		this->State = ETimecodeProviderSynchronizationState::Synchronized;
-		this->MostRecentFrameTime = FQualifiedFrameTime(Timecode, Rate);
+
+		FTimecodeSnapshot Next = this->Snapshot;
+		const double NominalInterval = Rate.IsValid() ? Rate.AsInterval() : 0.0;
+		const double Interval = ArrivalTime - Next.ArrivalTime;
+
+		// Smooth the measured interval, starting over from the frame rate after a gap or a rate change
+		if ((NominalInterval > 0.0) && (Next.ArrivalTime > 0.0) && (Next.FrameTime.Rate == Rate) &&
+		    (Interval > 0.0) && (Interval < (NominalInterval * 4.0)))
+		{
+			Next.FrameInterval = (Next.FrameInterval > 0.0) ? FMath::Lerp(Next.FrameInterval, Interval, 0.1) : Interval;
+			Next.FrameInterval = FMath::Clamp(Next.FrameInterval, NominalInterval * 0.5, NominalInterval * 2.0);
+		}
+		else
+		{
+			Next.FrameInterval = NominalInterval;
+		}
+
+		Next.State = ETimecodeProviderSynchronizationState::Synchronized;
+		this->TimecodeConverter.SetFrameRate(Rate);
+		Next.FrameTime = FQualifiedFrameTime(FFrameTime(FFrameNumber(int32(this->TimecodeConverter.ToFrameNumber(Timecode)))), Rate);
+		Next.ArrivalTime = ArrivalTime;
+
+		PublishSnapshot(Next);
 	});
 	this->ConnectedEventHandle = this->NDIMediaSource->OnNDIReceiverConnectedEvent.AddLambda([this](UNDIMediaReceiver* Receiver)
 	{
 		FScopeLock Lock(&this->StateSyncContext);
-		this->State = ETimecodeProviderSynchronizationState::Synchronizing;
+
+		FTimecodeSnapshot Next = this->Snapshot;
+		Next.State = ETimecodeProviderSynchronizationState::Synchronizing;
+		PublishSnapshot(Next);
 	});
 	this->DisconnectedEventHandle = this->NDIMediaSource->OnNDIReceiverDisconnectedEvent.AddLambda([this](UNDIMediaReceiver* Receiver)
 	{
 		FScopeLock Lock(&this->StateSyncContext);
-		this->State = ETimecodeProviderSynchronizationState::Closed;
+
+		FTimecodeSnapshot Next = this->Snapshot;
+		Next.State = ETimecodeProviderSynchronizationState::Closed;
+		Next.ArrivalTime = 0.0;
+		Next.FrameInterval = 0.0;
+		PublishSnapshot(Next);
 	});
 
 	return true;
@@ -97,5 +147,39 @@ void UNDITimecodeProvider::ReleaseResources()
 	this->ConnectedEventHandle.Reset();
 	this->DisconnectedEventHandle.Reset();
 
-	this->State = ETimecodeProviderSynchronizationState::Closed;
+	PublishSnapshot(FTimecodeSnapshot());
+}
+
+void UNDITimecodeProvider::PublishSnapshot(const FTimecodeSnapshot& InSnapshot)
+{
+	FScopeLock Lock(&this->StateSyncContext);
+
+	const uint32 Sequence = this->SnapshotSequence.load(std::memory_order_relaxed);
+	this->SnapshotSequence.store(Sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	this->Snapshot = InSnapshot;
+
+	this->SnapshotSequence.store(Sequence + 2, std::memory_order_release);
+}
+
+UNDITimecodeProvider::FTimecodeSnapshot UNDITimecodeProvider::ReadSnapshot() const
+{
+	FTimecodeSnapshot Current;
+
+	for (;;)
+	{
+		const uint32 Sequence = this->SnapshotSequence.load(std::memory_order_acquire);
+		if ((Sequence & 1) != 0)
+		{
+			FPlatformProcess::Yield();
+			continue;
+		}
+
+		Current = this->Snapshot;
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (this->SnapshotSequence.load(std::memory_order_relaxed) == Sequence)
+			return Current;
+	}
 }
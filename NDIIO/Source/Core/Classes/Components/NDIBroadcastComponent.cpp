@@ -139,6 +139,14 @@ void UNDIBroadcastComponent::GetNumberOfConnections(int32& Result)
 	}
 }
 
+/**
+	Returns the current performance data of the sender
+*/
+FNDISenderPerformanceData UNDIBroadcastComponent::GetPerformanceData() const
+{
+	return IsValid(NDIMediaSource) ? NDIMediaSource->GetPerformanceData() : FNDISenderPerformanceData();
+}
+
 /**
 	Attempts to immediately stop sending frames over NDI to any connected receivers
 */
@@ -7,6 +7,7 @@
 
 #include <Components/NDIFinderComponent.h>
 #include <Services/NDIFinderService.h>
+#include <NDIIOPluginModule.h>
 
 UNDIFinderComponent::UNDIFinderComponent(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
 
@@ -14,15 +15,31 @@ void UNDIFinderComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Discovery is started on first use of the plugin
+	FNDIIOPluginModule::EnsureNDIRuntime();
+
 	// Provide some sense of thread-safety
 	FScopeLock Lock(&CollectionSyncContext);
 
+	if (bUseOwnDiscoveryScope)
+	{
+		// Discover the sources within our own scope, alongside the plugin's finder service
+		ScopedFinderService = MakeShareable(new FNDIFinderService(DiscoveryScope));
+		ScopedFinderService->Start();
+
+		ScopedSourceCollectionDeltaHandle = ScopedFinderService->OnSourceCollectionDelta().AddWeakLambda(this, [this](const FNDISourceCollectionDelta& Delta)
+		{
+			this->OnNetworkSourceCollectionDelta(Delta);
+		});
+		return;
+	}
+
 	// Update the NetworkSourceCollection with some sources which that the service has already found
-	FNDIFinderService::UpdateSourceCollection(NetworkSourceCollection);
+	FNDIFinderService::UpdateSourceCollection(NetworkSourceCollection, NetworkSourceGeneration);
 
-	// Ensure that we are subscribed to the collection changed notification so we can handle it locally
-	FNDIFinderService::EventOnNDISourceCollectionChanged.AddUObject(
-		this, &UNDIFinderComponent::OnNetworkSourceCollectionChangedEvent);
+	// Ensure that we are subscribed to the changes of the collection so we can apply them locally
+	FNDIFinderService::EventOnNDISourceCollectionDelta.AddUObject(
+		this, &UNDIFinderComponent::OnNetworkSourceCollectionDelta);
 }
 
 void UNDIFinderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -34,9 +51,19 @@ void UNDIFinderComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	// Empty the source collection
 	this->NetworkSourceCollection.Empty(0);
+	this->NetworkSourceGeneration = 0;
 
 	// Ensure that we are no longer subscribed to collection change notifications
-	FNDIFinderService::EventOnNDISourceCollectionChanged.RemoveAll(this);
+	FNDIFinderService::EventOnNDISourceCollectionDelta.RemoveAll(this);
+
+	if (ScopedFinderService.IsValid())
+	{
+		ScopedFinderService->OnSourceCollectionDelta().Remove(ScopedSourceCollectionDeltaHandle);
+		ScopedSourceCollectionDeltaHandle.Reset();
+
+		ScopedFinderService->Shutdown();
+		ScopedFinderService.Reset();
+	}
 }
 
 /**
@@ -52,7 +79,39 @@ void UNDIFinderComponent::OnNetworkSourceCollectionChangedEvent()
 
 	// Check to determine if something actually changed within the collection. We don't want to trigger
 	// notifications unnecessarily.
-	if (FNDIFinderService::UpdateSourceCollection(NetworkSourceCollection))
+	const bool bHasCollectionChanged = ScopedFinderService.IsValid()
+		? ScopedFinderService->UpdateSources(NetworkSourceCollection, NetworkSourceGeneration)
+		: FNDIFinderService::UpdateSourceCollection(NetworkSourceCollection, NetworkSourceGeneration);
+
+	if (bHasCollectionChanged)
+	{
+		// Trigger the blueprint handling of the situation.
+		this->OnNetworkSourcesChangedEvent();
+
+		// If any listeners have subscribed broadcast any collection changes
+		if (this->OnNetworkSourcesChanged.IsBound())
+			this->OnNetworkSourcesChanged.Broadcast(this);
+	}
+}
+
+/**
+	Applies the changes the NDI Finder Service notifies listeners of to the network source collection, without copying
+	the sources which did not change
+*/
+void UNDIFinderComponent::OnNetworkSourceCollectionDelta(const FNDISourceCollectionDelta& Delta)
+{
+	FScopeLock Lock(&CollectionSyncContext);
+
+	const uint64 PreviousGeneration = NetworkSourceGeneration;
+
+	// A change was missed, so start over from the whole collection
+	if (!Delta.ApplyTo(NetworkSourceCollection, NetworkSourceGeneration))
+	{
+		OnNetworkSourceCollectionChangedEvent();
+		return;
+	}
+
+	if (NetworkSourceGeneration != PreviousGeneration)
 	{
 		// Trigger the blueprint handling of the situation.
 		this->OnNetworkSourcesChangedEvent();
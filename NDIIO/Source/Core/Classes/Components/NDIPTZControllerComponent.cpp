@@ -22,7 +22,7 @@ public:
 		: PTZController(PTZControllerIn)
 	{}
 
-	virtual bool ProcessOpen(const TCHAR* ElementName, const TCHAR* ElementData)
+	virtual bool ProcessOpenUtf8(uint32 ElementHash, FAnsiStringView ElementName) override
 	{
 		PanSpeed = 0.0;
 		TiltSpeed = 0.0;
@@ -30,23 +30,23 @@ public:
 		return true;
 	}
 
-	virtual bool ProcessAttribute(const TCHAR* AttributeName, const TCHAR* AttributeValue) override
+	virtual bool ProcessAttributeUtf8(uint32 AttributeHash, FAnsiStringView AttributeName, FAnsiStringView AttributeValue) override
 	{
-		if(FCString::Strcmp(TEXT("pan_speed"), AttributeName) == 0)
+		if(AttributeHash == NDIXmlHash("pan_speed"))
 		{
-			PanSpeed = FCString::Atod(AttributeValue);
+			PanSpeed = NDIXmlToDouble(AttributeValue);
 		}
-		else if(FCString::Strcmp(TEXT("tilt_speed"), AttributeName) == 0)
+		else if(AttributeHash == NDIXmlHash("tilt_speed"))
 		{
-			TiltSpeed = FCString::Atod(AttributeValue);
+			TiltSpeed = NDIXmlToDouble(AttributeValue);
 		}
 
 		return true;
 	}
 
-	virtual bool ProcessClose(const TCHAR* ElementName) override
+	virtual bool ProcessCloseUtf8(uint32 ElementHash, FAnsiStringView ElementName) override
 	{
-		PTZController->SetPTZPanTiltSpeed(PanSpeed, TiltSpeed);
+		PTZController->QueuePTZPanTiltSpeed(PanSpeed, TiltSpeed);
 
 		return true;
 	}
@@ -65,26 +65,26 @@ public:
 		: PTZController(PTZControllerIn)
 	{}
 
-	virtual bool ProcessOpen(const TCHAR* ElementName, const TCHAR* ElementData)
+	virtual bool ProcessOpenUtf8(uint32 ElementHash, FAnsiStringView ElementName) override
 	{
 		ZoomSpeed = 0.0;
 
 		return true;
 	}
 
-	virtual bool ProcessAttribute(const TCHAR* AttributeName, const TCHAR* AttributeValue) override
+	virtual bool ProcessAttributeUtf8(uint32 AttributeHash, FAnsiStringView AttributeName, FAnsiStringView AttributeValue) override
 	{
-		if(FCString::Strcmp(TEXT("zoom_speed"), AttributeName) == 0)
+		if(AttributeHash == NDIXmlHash("zoom_speed"))
 		{
-			ZoomSpeed = FCString::Atod(AttributeValue);
+			ZoomSpeed = NDIXmlToDouble(AttributeValue);
 		}
 
 		return true;
 	}
 
-	virtual bool ProcessClose(const TCHAR* ElementName) override
+	virtual bool ProcessCloseUtf8(uint32 ElementHash, FAnsiStringView ElementName) override
 	{
-		PTZController->SetPTZZoomSpeed(ZoomSpeed);
+		PTZController->QueuePTZZoomSpeed(ZoomSpeed);
 
 		return true;
 	}
@@ -102,7 +102,7 @@ public:
 		: PTZController(PTZControllerIn)
 	{}
 
-	virtual bool ProcessOpen(const TCHAR* ElementName, const TCHAR* ElementData)
+	virtual bool ProcessOpenUtf8(uint32 ElementHash, FAnsiStringView ElementName) override
 	{
 		AutoMode = true;
 		Distance = 0.5;
@@ -110,24 +110,24 @@ public:
 		return true;
 	}
 
-	virtual bool ProcessAttribute(const TCHAR* AttributeName, const TCHAR* AttributeValue) override
+	virtual bool ProcessAttributeUtf8(uint32 AttributeHash, FAnsiStringView AttributeName, FAnsiStringView AttributeValue) override
 	{
-		if(FCString::Strcmp(TEXT("mode"), AttributeName) == 0)
+		if(AttributeHash == NDIXmlHash("mode"))
 		{
-			if(FCString::Strcmp(TEXT("manual"), AttributeValue) == 0)
+			if(NDIXmlHash(AttributeValue) == NDIXmlHash("manual"))
 				AutoMode = false;
 		}
-		else if(FCString::Strcmp(TEXT("distance"), AttributeName) == 0)
+		else if(AttributeHash == NDIXmlHash("distance"))
 		{
-			Distance = FCString::Atod(AttributeValue);
+			Distance = NDIXmlToDouble(AttributeValue);
 		}
 
 		return true;
 	}
 
-	virtual bool ProcessClose(const TCHAR* ElementName) override
+	virtual bool ProcessCloseUtf8(uint32 ElementHash, FAnsiStringView ElementName) override
 	{
-		PTZController->SetPTZFocus(AutoMode, Distance);
+		PTZController->QueuePTZFocus(AutoMode, Distance);
 
 		return true;
 	}
@@ -146,25 +146,26 @@ public:
 		: PTZController(PTZControllerIn)
 	{}
 
-	virtual bool ProcessOpen(const TCHAR* ElementName, const TCHAR* ElementData)
+	virtual bool ProcessOpenUtf8(uint32 ElementHash, FAnsiStringView ElementName) override
 	{
 		StoreIndex = -1;
 
 		return true;
 	}
 
-	virtual bool ProcessAttribute(const TCHAR* AttributeName, const TCHAR* AttributeValue) override
+	virtual bool ProcessAttributeUtf8(uint32 AttributeHash, FAnsiStringView AttributeName, FAnsiStringView AttributeValue) override
 	{
-		if(FCString::Strcmp(TEXT("index"), AttributeName) == 0)
+		if(AttributeHash == NDIXmlHash("index"))
 		{
-			StoreIndex = FCString::Atoi(AttributeValue);
+			StoreIndex = NDIXmlToInt(AttributeValue);
 		}
 
 		return true;
 	}
 
-	virtual bool ProcessClose(const TCHAR* ElementName) override
+	virtual bool ProcessCloseUtf8(uint32 ElementHash, FAnsiStringView ElementName) override
 	{
+		PTZController->CountPTZCommand(StoreIndex >= 0);
 		if(StoreIndex >= 0)
 		{
 			PTZController->StorePTZState(StoreIndex);
@@ -186,25 +187,26 @@ public:
 		: PTZController(PTZControllerIn)
 	{}
 
-	virtual bool ProcessOpen(const TCHAR* ElementName, const TCHAR* ElementData)
+	virtual bool ProcessOpenUtf8(uint32 ElementHash, FAnsiStringView ElementName) override
 	{
 		RecallIndex = -1;
 
 		return true;
 	}
 
-	virtual bool ProcessAttribute(const TCHAR* AttributeName, const TCHAR* AttributeValue) override
+	virtual bool ProcessAttributeUtf8(uint32 AttributeHash, FAnsiStringView AttributeName, FAnsiStringView AttributeValue) override
 	{
-		if(FCString::Strcmp(TEXT("index"), AttributeName) == 0)
+		if(AttributeHash == NDIXmlHash("index"))
 		{
-			RecallIndex = FCString::Atoi(AttributeValue);
+			RecallIndex = NDIXmlToInt(AttributeValue);
 		}
 
 		return true;
 	}
 
-	virtual bool ProcessClose(const TCHAR* ElementName) override
+	virtual bool ProcessCloseUtf8(uint32 ElementHash, FAnsiStringView ElementName) override
 	{
+		PTZController->CountPTZCommand(RecallIndex >= 0);
 		if(RecallIndex >= 0)
 		{
 			PTZController->RecallPTZState(RecallIndex);
@@ -231,7 +233,7 @@ UPTZController::UPTZController()
 	this->PrimaryComponentTick.bCanEverTick = true;
 	this->PrimaryComponentTick.bHighPriority = true;
 	this->PrimaryComponentTick.bRunOnAnyThread = false;
-	this->PrimaryComponentTick.bStartWithTickEnabled = true;
+	this->PrimaryComponentTick.bStartWithTickEnabled = false;	// Enabled while the camera moves
 	this->PrimaryComponentTick.bTickEvenWhenPaused = true;
 
 	this->NDIMetadataParser = MakeShareable(new NDIXmlParser());
@@ -252,8 +254,8 @@ void UPTZController::InitializeComponent()
 	if (IsValid(NDIMediaSource))
 	{
 		// Ensure the PTZ controller is subscribed to the sender receiving metadata
-		this->NDIMediaSource->OnSenderMetaDataReceived.RemoveAll(this);
-		this->NDIMediaSource->OnSenderMetaDataReceived.AddDynamic(this, &UPTZController::ReceiveMetaDataFromSender);
+		this->NDIMediaSource->OnNDISenderMetadataCaptureEvent.RemoveAll(this);
+		this->NDIMediaSource->OnNDISenderMetadataCaptureEvent.AddUObject(this, &UPTZController::ReceiveMetaDataUtf8FromSender);
 	}
 }
 
@@ -269,8 +271,8 @@ bool UPTZController::Initialize(UNDIMediaSender* InMediaSource)
 		if (IsValid(NDIMediaSource))
 		{
 			// Ensure the PTZ controller is subscribed to the sender receiving metadata
-			this->NDIMediaSource->OnSenderMetaDataReceived.RemoveAll(this);
-			this->NDIMediaSource->OnSenderMetaDataReceived.AddDynamic(this, &UPTZController::ReceiveMetaDataFromSender);
+			this->NDIMediaSource->OnNDISenderMetadataCaptureEvent.RemoveAll(this);
+			this->NDIMediaSource->OnNDISenderMetadataCaptureEvent.AddUObject(this, &UPTZController::ReceiveMetaDataUtf8FromSender);
 		}
 	}
 
@@ -282,6 +284,7 @@ void UPTZController::SetPTZPanTiltSpeed(float PanSpeed, float TiltSpeed)
 {
 	PTZPanSpeed = PanSpeed;
 	PTZTiltSpeed = TiltSpeed;
+	UpdatePTZTickEnabled();
 
 	OnPTZPanTiltSpeed.Broadcast(PanSpeed, TiltSpeed);
 }
@@ -289,10 +292,29 @@ void UPTZController::SetPTZPanTiltSpeed(float PanSpeed, float TiltSpeed)
 void UPTZController::SetPTZZoomSpeed(float ZoomSpeed)
 {
 	PTZZoomSpeed = ZoomSpeed;
+	UpdatePTZTickEnabled();
 
 	OnPTZZoomSpeed.Broadcast(ZoomSpeed);
 }
 
+void UPTZController::SetPanSpeed(float PanSpeed)
+{
+	PTZPanSpeed = PanSpeed;
+	UpdatePTZTickEnabled();
+}
+
+void UPTZController::SetTiltSpeed(float TiltSpeed)
+{
+	PTZTiltSpeed = TiltSpeed;
+	UpdatePTZTickEnabled();
+}
+
+void UPTZController::SetZoomSpeed(float ZoomSpeed)
+{
+	PTZZoomSpeed = ZoomSpeed;
+	UpdatePTZTickEnabled();
+}
+
 void UPTZController::SetPTZFocus(bool AutoMode, float Distance)
 {
 	FPTZState PTZState = GetPTZStateFromUE();
@@ -326,6 +348,7 @@ void UPTZController::RecallPTZState(int Index)
 			PTZStateInterp.PTZTargetState = PTZStoredStates[Index];
 			PTZStateInterp.EasingDuration = PTZRecallEasing;
 			PTZStateInterp.EasingRemaining = PTZStateInterp.EasingDuration;
+			UpdatePTZTickEnabled();
 		}
 		else
 		{
@@ -388,6 +411,8 @@ void UPTZController::TickComponent(float DeltaTime, ELevelTick TickType, FActorC
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	ApplyPendingPTZCommands();
+
 	bool bUpdatePTZ = false;
 
 	if(PTZStateInterp.EasingRemaining > 0)
@@ -451,21 +476,125 @@ void UPTZController::TickComponent(float DeltaTime, ELevelTick TickType, FActorC
 
 		SetPTZStateToUE(PTZState);
 	}
+
+	UpdatePTZTickEnabled();
+}
+
+void UPTZController::QueuePTZPanTiltSpeed(float PanSpeed, float TiltSpeed)
+{
+	CountPTZCommand(false);
+
+	// Replaces the command which was queued before it within the frame
+	if(PendingCommands.bPanTiltSpeed)
+		++CommandStats.DroppedCommands;
+
+	PendingCommands.bPanTiltSpeed = true;
+	PendingCommands.PanSpeed = PanSpeed;
+	PendingCommands.TiltSpeed = TiltSpeed;
+
+	UpdatePTZTickEnabled();
+}
+
+void UPTZController::QueuePTZZoomSpeed(float ZoomSpeed)
+{
+	CountPTZCommand(false);
+
+	if(PendingCommands.bZoomSpeed)
+		++CommandStats.DroppedCommands;
+
+	PendingCommands.bZoomSpeed = true;
+	PendingCommands.ZoomSpeed = ZoomSpeed;
+
+	UpdatePTZTickEnabled();
+}
+
+void UPTZController::QueuePTZFocus(bool AutoMode, float Distance)
+{
+	CountPTZCommand(false);
+
+	if(PendingCommands.bFocus)
+		++CommandStats.DroppedCommands;
+
+	PendingCommands.bFocus = true;
+	PendingCommands.bAutoFocus = AutoMode;
+	PendingCommands.FocusDistance = Distance;
+
+	UpdatePTZTickEnabled();
+}
+
+void UPTZController::CountPTZCommand(bool bApplied)
+{
+	++CommandStats.ReceivedCommands;
+	if(bApplied)
+		++CommandStats.AppliedCommands;
+
+	const double Now = FPlatformTime::Seconds();
+	++CommandRateWindowCommands;
+	if((Now - CommandRateWindowStart) >= 1.0)
+	{
+		CommandStats.CommandRate = (CommandRateWindowStart > 0) ? (CommandRateWindowCommands / (Now - CommandRateWindowStart)) : 0.f;
+		CommandRateWindowStart = Now;
+		CommandRateWindowCommands = 0;
+	}
+}
+
+FPTZCommandStats UPTZController::GetPTZCommandStats() const
+{
+	FPTZCommandStats Stats = CommandStats;
+
+	// No commands for over a second
+	if((FPlatformTime::Seconds() - CommandRateWindowStart) >= 2.0)
+		Stats.CommandRate = 0.f;
+
+	return Stats;
+}
+
+void UPTZController::ApplyPendingPTZCommands()
+{
+	if(!PendingCommands.HasAny())
+		return;
+
+	const FPendingPTZCommands Commands = PendingCommands;
+	PendingCommands = FPendingPTZCommands();
+
+	if(Commands.bPanTiltSpeed)
+	{
+		SetPTZPanTiltSpeed(Commands.PanSpeed, Commands.TiltSpeed);
+		++CommandStats.AppliedCommands;
+	}
+	if(Commands.bZoomSpeed)
+	{
+		SetPTZZoomSpeed(Commands.ZoomSpeed);
+		++CommandStats.AppliedCommands;
+	}
+	if(Commands.bFocus)
+	{
+		SetPTZFocus(Commands.bAutoFocus, Commands.FocusDistance);
+		++CommandStats.AppliedCommands;
+	}
+}
+
+bool UPTZController::IsPTZInMotion() const
+{
+	return (PTZStateInterp.EasingRemaining > 0) || (PTZPanSpeed != 0) || (PTZTiltSpeed != 0) || (PTZZoomSpeed != 0);
+}
+
+void UPTZController::UpdatePTZTickEnabled()
+{
+	// Idle controllers do not tick
+	const bool bShouldTick = IsPTZInMotion() || PendingCommands.HasAny();
+	if(bShouldTick != IsComponentTickEnabled())
+		SetComponentTickEnabled(bShouldTick);
 }
 
 
 void UPTZController::ReceiveMetaDataFromSender(UNDIMediaSender* Sender, FString Data)
 {
-	FText OutErrorMessage;
-	int32 OutErrorLineNumber;
-
-	FFastXml::ParseXmlFile(this->NDIMetadataParser.Get(),
-		nullptr,						// XmlFilePath
-		Data.GetCharArray().GetData(),	// XmlFileContents
-		nullptr,						// FeedbackContext
-		false,							// bShowSlowTaskDialog
-		false,							// bShowCancelButton
-		OutErrorMessage,				// OutErrorMessage
-		OutErrorLineNumber				// OutErrorLineNumber
-	);
+	FTCHARToUTF8 Utf8Data(*Data);
+	ReceiveMetaDataUtf8FromSender(Sender, Utf8Data.Get(), Utf8Data.Length());
+}
+
+void UPTZController::ReceiveMetaDataUtf8FromSender(UNDIMediaSender* Sender, const ANSICHAR* Data, int32 Length)
+{
+	this->NDIMetadataParser->ParseUtf8(Data, Length);
 }
@@ -25,7 +25,7 @@ public:
 		: TriCasterExtComponent(TriCasterExtComponentIn)
 	{}
 
-	virtual bool ProcessOpen(const TCHAR* ElementName, const TCHAR* ElementData)
+	virtual bool ProcessOpenUtf8(uint32 ElementHash, FAnsiStringView ElementName) override
 	{
 		TCData.Value = FString();
 		TCData.KeyValues.Empty();
@@ -33,23 +33,23 @@ public:
 		return true;
 	}
 
-	virtual bool ProcessAttribute(const TCHAR* AttributeName, const TCHAR* AttributeValue) override
+	virtual bool ProcessAttributeUtf8(uint32 AttributeHash, FAnsiStringView AttributeName, FAnsiStringView AttributeValue) override
 	{
-		if(FCString::Strcmp(TEXT("name"), AttributeName) == 0)
+		if(AttributeHash == NDIXmlHash("name"))
 		{}
-		else if(FCString::Strcmp(TEXT("value"), AttributeName) == 0)
+		else if(AttributeHash == NDIXmlHash("value"))
 		{
-			TCData.Value = FString(AttributeValue);
+			TCData.Value = NDIXmlToString(AttributeValue);
 		}
 		else
 		{
-			TCData.KeyValues.Add(FName(AttributeName), FString(AttributeValue));
+			TCData.KeyValues.Add(FName(AttributeName.Len(), AttributeName.GetData()), NDIXmlToString(AttributeValue));
 		}
 
 		return true;
 	}
 
-	virtual bool ProcessClose(const TCHAR* ElementName) override
+	virtual bool ProcessCloseUtf8(uint32 ElementHash, FAnsiStringView ElementName) override
 	{
 		if(TCData.Value == "ndiio")
 		{
@@ -61,10 +61,6 @@ public:
 
 			if((ActorNamePtr != nullptr) && (PropertyNamePtr != nullptr) && (PropertyValueStrPtr != nullptr))
 			{
-				FString PropertyBaseName, PropertyElementName;
-				if(!PropertyNamePtr->Split(TEXT(":"), &PropertyBaseName, &PropertyElementName))
-					PropertyBaseName = *PropertyNamePtr;
-
 				FTimespan EasingDuration = 0;
 				if(EasingDurationPtr != nullptr)
 				{
@@ -72,65 +68,7 @@ public:
 					EasingDuration = FTimespan::FromSeconds(Seconds);
 				}
 
-				for(TActorIterator<AActor> ActorItr(TriCasterExtComponent->GetWorld()); ActorItr; ++ActorItr)
-				{
-					AActor* Actor = *ActorItr;
-					if(Actor->GetName() == *ActorNamePtr)
-					{
-						UObject* FoundObject = nullptr;
-						FProperty* FoundProperty = nullptr;
-
-						if(ComponentNamePtr != nullptr)
-						{
-							TInlineComponentArray<UActorComponent*> PrimComponents;
-							Actor->GetComponents(PrimComponents, true);
-							for(auto& CompIt : PrimComponents)
-							{
-								if(CompIt->GetName() == *ComponentNamePtr)
-								{
-									FProperty* Property = CompIt->GetClass()->FindPropertyByName(*PropertyBaseName);
-									if(Property)
-									{
-										FoundObject = CompIt;
-										FoundProperty = Property;
-										break;
-									}
-								}
-							}
-						}
-						else
-						{
-							FProperty* ActorProperty = Actor->GetClass()->FindPropertyByName(*PropertyBaseName);
-							if(ActorProperty)
-							{
-								FoundObject = Actor;
-								FoundProperty = ActorProperty;
-							}
-							else
-							{
-								TInlineComponentArray<UActorComponent*> PrimComponents;
-								Actor->GetComponents(PrimComponents, true);
-
-								for(auto& CompIt : PrimComponents)
-								{
-									FProperty* CompProperty = CompIt->GetClass()->FindPropertyByName(*PropertyBaseName);
-									if(CompProperty)
-									{
-										FoundObject = CompIt;
-										FoundProperty = CompProperty;
-										break;
-									}
-								}
-							}
-						}
-
-						if(FoundObject && FoundProperty)
-						{
-							TriCasterExtComponent->TriCasterExt(Actor, FoundObject, FoundProperty, PropertyElementName, *PropertyValueStrPtr, EasingDuration);
-							break;
-						}
-					}
-				}
+				TriCasterExtComponent->TriCasterExtProperty(*ActorNamePtr, ComponentNamePtr, *PropertyNamePtr, *PropertyValueStrPtr, EasingDuration);
 			}
 		}
 
@@ -177,8 +115,8 @@ void UTriCasterExtComponent::InitializeComponent()
 	if (IsValid(NDIMediaSource))
 	{
 		// Ensure the TriCasterExt component is subscribed to the sender receiving metadata
-		this->NDIMediaSource->OnSenderMetaDataReceived.RemoveAll(this);
-		this->NDIMediaSource->OnSenderMetaDataReceived.AddDynamic(this, &UTriCasterExtComponent::ReceiveMetaDataFromSender);
+		this->NDIMediaSource->OnNDISenderMetadataCaptureEvent.RemoveAll(this);
+		this->NDIMediaSource->OnNDISenderMetadataCaptureEvent.AddUObject(this, &UTriCasterExtComponent::ReceiveMetaDataUtf8FromSender);
 	}
 }
 
@@ -194,8 +132,8 @@ bool UTriCasterExtComponent::Initialize(UNDIMediaSender* InMediaSource)
 		if (IsValid(NDIMediaSource))
 		{
 			// Ensure the TriCasterExt component is subscribed to the sender receiving metadata
-			this->NDIMediaSource->OnSenderMetaDataReceived.RemoveAll(this);
-			this->NDIMediaSource->OnSenderMetaDataReceived.AddDynamic(this, &UTriCasterExtComponent::ReceiveMetaDataFromSender);
+			this->NDIMediaSource->OnNDISenderMetadataCaptureEvent.RemoveAll(this);
+			this->NDIMediaSource->OnNDISenderMetadataCaptureEvent.AddUObject(this, &UTriCasterExtComponent::ReceiveMetaDataUtf8FromSender);
 		}
 	}
 
@@ -203,25 +141,256 @@ bool UTriCasterExtComponent::Initialize(UNDIMediaSender* InMediaSource)
 	return InMediaSource != nullptr && InMediaSource == NDIMediaSource;
 }
 
+void UTriCasterExtComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Bindings are resolved by name, so they are dropped when an actor of that name comes or goes
+	if (UWorld* World = GetWorld())
+	{
+		ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UTriCasterExtComponent::InvalidateBindings));
+		ActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &UTriCasterExtComponent::InvalidateBindings));
+	}
+
+	// Actors of streamed levels are not spawned
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UTriCasterExtComponent::InvalidateAllBindings);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UTriCasterExtComponent::InvalidateAllBindings);
+}
+
+void UTriCasterExtComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+	ActorSpawnedHandle.Reset();
+	ActorDestroyedHandle.Reset();
+
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	LevelAddedHandle.Reset();
+	LevelRemovedHandle.Reset();
+
+	Bindings.Empty();
+	TriCasterExtInterp.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UTriCasterExtComponent::InvalidateBindings(AActor* Actor)
+{
+	if (Actor != nullptr)
+	{
+		const FString ActorName = Actor->GetName();
+		for (auto It = Bindings.CreateIterator(); It; ++It)
+		{
+			if (It.Value().ActorName == ActorName)
+				It.RemoveCurrent();
+		}
+	}
+}
+
+void UTriCasterExtComponent::InvalidateAllBindings(ULevel* Level, UWorld* World)
+{
+	if (World == GetWorld())
+		Bindings.Empty();
+}
+
+const UTriCasterExtComponent::FTriCasterExtBinding& UTriCasterExtComponent::FindOrResolveBinding(const FString& ActorName, const FString* ComponentName, const FString& PropertyName)
+{
+	const FString Key = ActorName + TEXT("|") + ((ComponentName != nullptr) ? *ComponentName : FString()) + TEXT("|") + PropertyName;
+
+	FTriCasterExtBinding* Binding = Bindings.Find(Key);
+
+	// Bindings which were not resolved are kept too, until they are invalidated; resolved ones whose
+	// objects have gone are resolved again
+	if ((Binding == nullptr) || ((Binding->Property != nullptr) && !Binding->IsResolved()))
+	{
+		Binding = &Bindings.Add(Key);
+		Binding->ActorName = ActorName;
+
+		FString PropertyBaseName;
+		if(!PropertyName.Split(TEXT(":"), &PropertyBaseName, &Binding->PropertyElementName))
+			PropertyBaseName = PropertyName;
+
+		ResolveBinding(*Binding, ComponentName, PropertyBaseName);
+	}
+
+	return *Binding;
+}
+
+void UTriCasterExtComponent::ResolveBinding(FTriCasterExtBinding& Binding, const FString* ComponentName, const FString& PropertyBaseName) const
+{
+	const FName PropertyBaseFName(*PropertyBaseName);
+
+	for(TActorIterator<AActor> ActorItr(GetWorld()); ActorItr; ++ActorItr)
+	{
+		AActor* Actor = *ActorItr;
+		if(Actor->GetName() == Binding.ActorName)
+		{
+			UObject* FoundObject = nullptr;
+			FProperty* FoundProperty = nullptr;
+
+			if(ComponentName != nullptr)
+			{
+				TInlineComponentArray<UActorComponent*> PrimComponents;
+				Actor->GetComponents(PrimComponents, true);
+				for(auto& CompIt : PrimComponents)
+				{
+					if(CompIt->GetName() == *ComponentName)
+					{
+						FProperty* Property = CompIt->GetClass()->FindPropertyByName(PropertyBaseFName);
+						if(Property)
+						{
+							FoundObject = CompIt;
+							FoundProperty = Property;
+							break;
+						}
+					}
+				}
+			}
+			else
+			{
+				FProperty* ActorProperty = Actor->GetClass()->FindPropertyByName(PropertyBaseFName);
+				if(ActorProperty)
+				{
+					FoundObject = Actor;
+					FoundProperty = ActorProperty;
+				}
+				else
+				{
+					TInlineComponentArray<UActorComponent*> PrimComponents;
+					Actor->GetComponents(PrimComponents, true);
+
+					for(auto& CompIt : PrimComponents)
+					{
+						FProperty* CompProperty = CompIt->GetClass()->FindPropertyByName(PropertyBaseFName);
+						if(CompProperty)
+						{
+							FoundObject = CompIt;
+							FoundProperty = CompProperty;
+							break;
+						}
+					}
+				}
+			}
+
+			if(FoundObject && FoundProperty)
+			{
+				Binding.Actor = Actor;
+				Binding.Object = FoundObject;
+				Binding.Property = FoundProperty;
+
+				if(FNumericProperty* NumericProperty = CastField<FNumericProperty>(FoundProperty))
+				{
+					Binding.NumericProperty = NumericProperty;
+				}
+				else if(FStructProperty* StructProperty = CastField<FStructProperty>(FoundProperty))
+				{
+					if(!Binding.PropertyElementName.IsEmpty())
+					{
+						Binding.FieldProperty = FindFProperty<FProperty>(StructProperty->Struct, *Binding.PropertyElementName);
+						Binding.NumericProperty = CastField<FNumericProperty>(Binding.FieldProperty);
+					}
+				}
+
+				if(FoundObject->IsA<UActorComponent>())
+				{
+					const FName PropertyFName = FoundProperty->GetFName();
+					Binding.bUpdatesComponentTransform = (PropertyFName == TEXT("RelativeLocation")) ||
+					                                     (PropertyFName == TEXT("RelativeRotation")) ||
+					                                     (PropertyFName == TEXT("RelativeScale3D"));
+				}
+				return;
+			}
+		}
+	}
+}
+
+void UTriCasterExtComponent::TriCasterExtProperty(const FString& ActorName, const FString* ComponentName, const FString& PropertyName, const FString& PropertyValueStr, FTimespan EasingDuration)
+{
+	const FTriCasterExtBinding& Binding = FindOrResolveBinding(ActorName, ComponentName, PropertyName);
+	if(Binding.IsResolved())
+	{
+		AddTriCasterExtInterp(Binding, PropertyValueStr, EasingDuration);
+
+		OnTriCasterExt.Broadcast(Binding.Actor.Get(), Binding.Object.Get(), Binding.PropertyElementName, PropertyValueStr, EasingDuration);
+	}
+}
+
 void UTriCasterExtComponent::TriCasterExt(AActor* Actor, UObject* Object, FProperty* Property, FString PropertyElementName, FString PropertyValueStr, FTimespan EasingDuration)
 {
 	if(Actor && Object && Property)
 	{
-		FTriCasterExtInterp Interp;
-		Interp.Actor = Actor;
-		Interp.Object = Object;
-		Interp.Property = Property;
-		Interp.PropertyElementName = PropertyElementName;
-		Interp.PropertyValueStr = PropertyValueStr;
-		Interp.EasingDuration = EasingDuration.GetTotalSeconds();
-		Interp.EasingRemaining = Interp.EasingDuration;
-
-		TriCasterExtInterp.Add(Interp);
+		FTriCasterExtBinding Binding;
+		Binding.Actor = Actor;
+		Binding.Object = Object;
+		Binding.Property = Property;
+		Binding.PropertyElementName = PropertyElementName;
+
+		if(FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		{
+			Binding.NumericProperty = NumericProperty;
+		}
+		else if(FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if(!PropertyElementName.IsEmpty())
+			{
+				Binding.FieldProperty = FindFProperty<FProperty>(StructProperty->Struct, *PropertyElementName);
+				Binding.NumericProperty = CastField<FNumericProperty>(Binding.FieldProperty);
+			}
+		}
+
+		if(Object->IsA<UActorComponent>())
+		{
+			Binding.bUpdatesComponentTransform = (Property->GetFName() == TEXT("RelativeLocation")) ||
+			                                     (Property->GetFName() == TEXT("RelativeRotation")) ||
+			                                     (Property->GetFName() == TEXT("RelativeScale3D"));
+		}
+
+		AddTriCasterExtInterp(Binding, PropertyValueStr, EasingDuration);
 	}
 
 	OnTriCasterExt.Broadcast(Actor, Object, PropertyElementName, PropertyValueStr, EasingDuration);
 }
 
+void UTriCasterExtComponent::AddTriCasterExtInterp(const FTriCasterExtBinding& Binding, const FString& PropertyValueStr, FTimespan EasingDuration)
+{
+	// A new value for the same property takes over from the one still being eased towards
+	FTriCasterExtInterp* Interp = TriCasterExtInterp.FindByPredicate([&Binding](const FTriCasterExtInterp& Existing)
+	{
+		return (Existing.Object == Binding.Object) && (Existing.Property == Binding.Property) && (Existing.FieldProperty == Binding.FieldProperty);
+	});
+	if(Interp == nullptr)
+		Interp = &TriCasterExtInterp.AddDefaulted_GetRef();
+
+	Interp->Actor = Binding.Actor;
+	Interp->Object = Binding.Object;
+	Interp->Property = Binding.Property;
+	Interp->FieldProperty = Binding.FieldProperty;
+	Interp->NumericProperty = Binding.NumericProperty;
+	Interp->bUpdatesComponentTransform = Binding.bUpdatesComponentTransform;
+
+	// The target is parsed once, rather than on every tick
+	if(Binding.NumericProperty != nullptr)
+	{
+		Interp->TargetValue = FCString::Atod(*PropertyValueStr);
+		Interp->ImportText.Reset();
+	}
+	else if(!Binding.PropertyElementName.IsEmpty())
+	{
+		Interp->ImportText = TEXT("(") + Binding.PropertyElementName + TEXT("=") + PropertyValueStr + TEXT(")");
+	}
+	else
+	{
+		Interp->ImportText = PropertyValueStr;
+	}
+
+	Interp->EasingDuration = EasingDuration.GetTotalSeconds();
+	Interp->EasingRemaining = Interp->EasingDuration;
+}
+
 void UTriCasterExtComponent::TriCasterExtCustom(const FTriCasterExt& TCData)
 {
 	OnTriCasterExtCustom.Broadcast(TCData);
@@ -232,113 +401,92 @@ void UTriCasterExtComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	// The transforms of the components are updated once all the properties have been set
+	TArray<UActorComponent*, TInlineAllocator<16>> ComponentsToUpdate;
+
 	for(int32 i = 0; i < TriCasterExtInterp.Num(); ++i)
 	{
 		FTriCasterExtInterp& Interp = TriCasterExtInterp[i];
 
+		AActor* Actor = Interp.Actor.Get();
+		UObject* Object = Interp.Object.Get();
+		if((Actor == nullptr) || (Object == nullptr))
+		{
+			TriCasterExtInterp.RemoveAtSwap(i--);
+			continue;
+		}
+
 		float EasingDelta = FMath::Min(Interp.EasingRemaining, DeltaTime);
 
-		void* Data = Interp.Property->ContainerPtrToValuePtr<void>(Interp.Object);
+		void* Data = Interp.Property->ContainerPtrToValuePtr<void>(Object);
 		if(Data)
 		{
-			bool Done = false;
-
 #if WITH_EDITOR
-			Interp.Object->PreEditChange(Interp.Property);
-			Interp.Actor->PreEditChange(Interp.Property);
+			Object->PreEditChange(Interp.Property);
+			Actor->PreEditChange(Interp.Property);
 #endif
 
-			if(FNumericProperty* NumericProperty = CastField<FNumericProperty>(Interp.Property))
+			if(Interp.NumericProperty != nullptr)
 			{
-				double PropertyValue = NumericProperty->GetFloatingPointPropertyValue(Data);
-				double TargetValue = FCString::Atod(*Interp.PropertyValueStr);
+				void* ValueData = (Interp.FieldProperty != nullptr) ? Interp.FieldProperty->ContainerPtrToValuePtr<void>(Data) : Data;
+				double PropertyValue = Interp.NumericProperty->GetFloatingPointPropertyValue(ValueData);
 
 				double EasingFrac = (Interp.EasingRemaining > 0) ? (EasingDelta / Interp.EasingRemaining) : 1;
 				double EasingInterp = 3*EasingFrac - 3*EasingFrac*EasingFrac + EasingFrac*EasingFrac*EasingFrac;
 
-				double NewValue = PropertyValue * (1 - EasingInterp) + TargetValue * EasingInterp;
-				NumericProperty->SetFloatingPointPropertyValue(Data, NewValue);
-				Done = true;
+				double NewValue = PropertyValue * (1 - EasingInterp) + Interp.TargetValue * EasingInterp;
+				Interp.NumericProperty->SetFloatingPointPropertyValue(ValueData, NewValue);
 			}
-			else if(FStructProperty* StructProperty = CastField<FStructProperty>(Interp.Property))
+			else
 			{
-				FProperty* FieldProperty = FindFProperty<FProperty>(StructProperty->Struct, *(Interp.PropertyElementName));
-				if(FNumericProperty* StructNumericProperty = CastField<FNumericProperty>(FieldProperty))
-				{
-					void* FieldData = FieldProperty->ContainerPtrToValuePtr<void>(Data);
-					double PropertyValue = StructNumericProperty->GetFloatingPointPropertyValue(FieldData);
-					double TargetValue = FCString::Atod(*Interp.PropertyValueStr);
-
-					double EasingFrac = (Interp.EasingRemaining > 0) ? (EasingDelta / Interp.EasingRemaining) : 1;
-					double EasingInterp = 3*EasingFrac - 3*EasingFrac*EasingFrac + EasingFrac*EasingFrac*EasingFrac;
-
-					double NewValue = PropertyValue * (1 - EasingInterp) + TargetValue * EasingInterp;
-					StructNumericProperty->SetFloatingPointPropertyValue(FieldData, NewValue);
-					Done = true;
-				}
-			}
-
-			if(!Done)
-			{
-				FString ImportText;
-				if(!Interp.PropertyElementName.IsEmpty())
-					ImportText = "(" + Interp.PropertyElementName + "=" + Interp.PropertyValueStr + ")";
-				else
-					ImportText = Interp.PropertyValueStr;
 #if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))	// 5.1 and later
-				Interp.Property->ImportText_Direct(*ImportText, Data, Interp.Object, 0);
+				Interp.Property->ImportText_Direct(*Interp.ImportText, Data, Object, 0);
 #else
-				Interp.Property->ImportText(*ImportText, Data, 0, Interp.Object);
+				Interp.Property->ImportText(*Interp.ImportText, Data, 0, Object);
 #endif
 			}
 
-			UActorComponent* ActorComponent = Cast<UActorComponent>(Interp.Object);
-			if(ActorComponent)
+			if(Interp.bUpdatesComponentTransform)
 			{
-				if((Interp.Property->GetFName() == TEXT("RelativeLocation")) ||
-				   (Interp.Property->GetFName() == TEXT("RelativeRotation")) ||
-				   (Interp.Property->GetFName() == TEXT("RelativeScale3D")))
-				{
-					ActorComponent->UpdateComponentToWorld();
-				}
+				ComponentsToUpdate.AddUnique(static_cast<UActorComponent*>(Object));
 			}
 #if (ENGINE_MAJOR_VERSION < 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION < 3))	// Before 5.3
 			if(Interp.Property->HasAnyPropertyFlags(CPF_Interp))
-				Interp.Object->PostInterpChange(Interp.Property);
+				Object->PostInterpChange(Interp.Property);
 #endif
 
 #if WITH_EDITOR
 			TArray<const UObject*> ModifiedObjects;
-			ModifiedObjects.Add(Interp.Actor);
+			ModifiedObjects.Add(Actor);
 			FPropertyChangedEvent PropertyChangedEvent(Interp.Property, EPropertyChangeType::ValueSet, MakeArrayView(ModifiedObjects));
 			FEditPropertyChain PropertyChain;
 			PropertyChain.AddHead(Interp.Property);
 			FPropertyChangedChainEvent PropertyChangedChainEvent(PropertyChain, PropertyChangedEvent);
 
-			Interp.Object->PostEditChangeChainProperty(PropertyChangedChainEvent);
-			Interp.Actor->PostEditChangeChainProperty(PropertyChangedChainEvent);
+			Object->PostEditChangeChainProperty(PropertyChangedChainEvent);
+			Actor->PostEditChangeChainProperty(PropertyChangedChainEvent);
 #endif
 		}
 
 		Interp.EasingRemaining -= EasingDelta;
-		if(Interp.EasingRemaining == 0)
-			TriCasterExtInterp.RemoveAtSwap(i);
+		if(Interp.EasingRemaining <= 0)
+			TriCasterExtInterp.RemoveAtSwap(i--);
+	}
+
+	for(UActorComponent* Component : ComponentsToUpdate)
+	{
+		Component->UpdateComponentToWorld();
 	}
 }
 
 
 void UTriCasterExtComponent::ReceiveMetaDataFromSender(UNDIMediaSender* Sender, FString Data)
 {
-	FText OutErrorMessage;
-	int32 OutErrorLineNumber;
-
-	FFastXml::ParseXmlFile(this->NDIMetadataParser.Get(),
-		nullptr,						// XmlFilePath
-		Data.GetCharArray().GetData(),	// XmlFileContents
-		nullptr,						// FeedbackContext
-		false,							// bShowSlowTaskDialog
-		false,							// bShowCancelButton
-		OutErrorMessage,				// OutErrorMessage
-		OutErrorLineNumber				// OutErrorLineNumber
-	);
+	FTCHARToUTF8 Utf8Data(*Data);
+	ReceiveMetaDataUtf8FromSender(Sender, Utf8Data.Get(), Utf8Data.Length());
+}
+
+void UTriCasterExtComponent::ReceiveMetaDataUtf8FromSender(UNDIMediaSender* Sender, const ANSICHAR* Data, int32 Length)
+{
+	this->NDIMetadataParser->ParseUtf8(Data, Length);
 }
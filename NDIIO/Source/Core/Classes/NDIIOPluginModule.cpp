@@ -11,12 +11,17 @@
 #include <IMediaModule.h>
 #include <NDIIOPluginAPI.h>
 #include "Player/NDIMediaPlayer.h"
+#include "Objects/Media/NDIMediaReaper.h"
+#include "Objects/Media/NDIMediaSenderPool.h"
 #include <Misc/Paths.h>
+#include <Misc/FileHelper.h>
+#include <Async/Async.h>
 
 #include <GenericPlatform/GenericPlatformMisc.h>
 
 #include <Services/NDIConnectionService.h>
 #include <Services/NDIFinderService.h>
+#include <Services/NDIEventDispatcher.h>
 
 #include <Misc/MessageDialog.h>
 #include <Misc/EngineVersionComparison.h>
@@ -36,118 +41,195 @@
 
 #define LOCTEXT_NAMESPACE "FNDIIOPluginModule"
 
+FNDIIOPluginModule* FNDIIOPluginModule::PluginModule = nullptr;
+
 
 void FNDIIOPluginModule::StartupModule()
 {
 	// Doubly Ensure that this handle is nullptr
 	NDI_LIB_HANDLE = nullptr;
 
-	if (LoadModuleDependencies())
-	{
+	PluginModule = this;
+
 #if UE_EDITOR
 
-		if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
-		{
-			SettingsModule->RegisterSettings(
-				"Project", "Plugins", "NDI", LOCTEXT("NDISettingsName", "Vizrt NDI"),
-				LOCTEXT("NDISettingsDescription", "Vizrt NDI(R) Engine Intergration Settings"),
-				GetMutableDefault<UNDIIOPluginSettings>());
-		}
+	if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
+	{
+		SettingsModule->RegisterSettings(
+			"Project", "Plugins", "NDI", LOCTEXT("NDISettingsName", "Vizrt NDI"),
+			LOCTEXT("NDISettingsDescription", "Vizrt NDI(R) Engine Intergration Settings"),
+			GetMutableDefault<UNDIIOPluginSettings>());
+	}
 
-		// Ensure that the thumbnail for the 'NDI Media Texture2D' is being updated, as the texture is being used.
-		UThumbnailManager::Get().RegisterCustomRenderer(UNDIMediaTexture2D::StaticClass(),
-														UTextureThumbnailRenderer::StaticClass());
+	// Ensure that the thumbnail for the 'NDI Media Texture2D' is being updated, as the texture is being used.
+	UThumbnailManager::Get().RegisterCustomRenderer(UNDIMediaTexture2D::StaticClass(),
+													UTextureThumbnailRenderer::StaticClass());
 
 #endif
 
-		// Construct our Services
-		this->NDIFinderService = MakeShareable(new FNDIFinderService());
-		this->NDIConnectionService = MakeShareable(new FNDIConnectionService());
 
-		// Start the service
-		if (NDIFinderService.IsValid())
-			NDIFinderService->Start();
 
-		// Start the service
-		if (NDIConnectionService.IsValid())
-			NDIConnectionService->Start();
-	}
-	else
+	// supported platforms
+	SupportedPlatforms.Add(TEXT("Windows"));
+	SupportedPlatforms.Add(TEXT("Linux"));
+	SupportedPlatforms.Add(TEXT("LinuxAArch64"));
+	SupportedPlatforms.Add(TEXT("Android"));
+	// supported schemes
+	SupportedUriSchemes.Add(TEXT("ndiio"));
+
+	// register player factory
+	auto MediaModule = FModuleManager::LoadModulePtr<IMediaModule>("Media");
+
+	if (MediaModule != nullptr)
 	{
-#if PLATFORM_WINDOWS
-		// Write an error message to the log.
-		UE_LOG(LogWindows, Error,
-			   TEXT("Unable to load \"Processing.NDI.Lib.x64.dll\" from the NDI 6 Runtime Directory."));
+		MediaModule->RegisterPlayerFactory(*this);
+	}
 
-#if UE_EDITOR
+	FApp::SetUnfocusedVolumeMultiplier(1.f);
+
+	// Deliver the events raised by senders and receivers off the game thread to Blueprint
+	FNDIEventDispatcher::Start();
+
+	// Keep the sources of senders alive across level travel
+	FNDIMediaSenderPool::Startup();
 
-		const FText& WarningMessage =
-			LOCTEXT("NDIRuntimeMissing",
-					"Cannot find \"Processing.NDI.Lib.x64.dll\" from the NDI 6 Runtime Directory. "
-					"Continued usage of the plugin can cause instability within the editor.\r\n\r\n"
+	// Loading the NDI runtime and starting discovery is deferred until the plugin is first used, so that the editor
+	// and commandlets don't pay for it unless needed. Broadcasting on play needs it right away
+	const UNDIIOPluginSettings* CoreSettings = GetDefault<UNDIIOPluginSettings>();
+	if (CoreSettings->bBeginBroadcastOnPlay && !IsRunningCommandlet())
+	{
+		EnsureRuntimeLoaded();
+	}
+	else if (CoreSettings->bPreloadRuntime && !IsRunningCommandlet())
+	{
+		// Get a head start on discovery, without holding up the startup
+		PreloadFuture = Async(EAsyncExecution::ThreadPool, [this]()
+		{
+			EnsureRuntimeLoaded();
+		});
+	}
+}
 
-					"Please refer to the 'NDI IO Plugin for Unreal Engine Quickstart Guide' "
-					"for additional information related to installation instructions for this plugin.\r\n\r\n");
+/**
+	Loads the NDI runtime and starts the services, if that was not done yet. Can be called from any thread; the
+	services are started on the game thread
+*/
+bool FNDIIOPluginModule::EnsureRuntimeLoaded()
+{
+	{
+		FScopeLock Lock(&RuntimeSyncContext);
 
-		// Open a message box, showing that things will not work since the NDI Runtime Directory cannot be found
-		if (FMessageDialog::Open(EAppMsgType::OkCancel, EAppReturnType::Ok, WarningMessage) == EAppReturnType::Ok)
+		if (RuntimeState == ERuntimeState::NotLoaded)
 		{
-			FString URLResult = FString("");
-			FPlatformProcess::LaunchURL(*FString("https://ndi.video/sdk/"), nullptr, &URLResult);
+			RuntimeState = LoadModuleDependencies() ? ERuntimeState::Loaded : ERuntimeState::Failed;
+
+			if (RuntimeState == ERuntimeState::Failed)
+			{
+				if (IsInGameThread())
+					ReportMissingRuntime();
+				else
+					AsyncTask(ENamedThreads::GameThread, [this]() { ReportMissingRuntime(); });
+			}
 		}
 
-#endif
+		if (RuntimeState != ERuntimeState::Loaded)
+			return false;
+	}
 
-#elif PLATFORM_ANDROID
+	if (IsInGameThread())
+		StartServices();
+	else
+		AsyncTask(ENamedThreads::GameThread, [this]() { StartServices(); });
+
+	return true;
+}
 
-		UE_LOG(LogTemp, Warning, TEXT("NDIIO Plugin: Detected Android platform. Verifying NDI integration."));
+/**
+	Loads the NDI runtime on first use of the plugin
+*/
+bool FNDIIOPluginModule::EnsureNDIRuntime()
+{
+	return (PluginModule != nullptr) && PluginModule->EnsureRuntimeLoaded();
+}
 
+void FNDIIOPluginModule::StartServices()
+{
+	check(IsInGameThread());
 
+	if (bAreServicesStarted)
+		return;
 
-#elif (PLATFORM_LINUX || PLATFORM_LINUXARM64)
-		// Write an error message to the log.
-		UE_LOG(LogLinux, Error,
-			   TEXT("Unable to load \"" NDILIB_LIBRARY_NAME "\" from the NDI 6 Runtime."));
+	bAreServicesStarted = true;
+
+	// Construct our Services
+	this->NDIFinderService = MakeShareable(new FNDIFinderService());
+	this->NDIConnectionService = MakeShareable(new FNDIConnectionService());
+
+	// Start the service
+	if (NDIFinderService.IsValid())
+		NDIFinderService->Start();
+
+	// Start the service
+	if (NDIConnectionService.IsValid())
+		NDIConnectionService->Start();
+}
+
+void FNDIIOPluginModule::ReportMissingRuntime()
+{
+#if PLATFORM_WINDOWS
+	// Write an error message to the log.
+	UE_LOG(LogWindows, Error,
+		   TEXT("Unable to load \"Processing.NDI.Lib.x64.dll\" from the NDI 6 Runtime Directory."));
 
 #if UE_EDITOR
 
-		const FText& WarningMessage =
-			LOCTEXT("NDIRuntimeMissing",
-					"Cannot find \"" NDILIB_LIBRARY_NAME "\" from the NDI 6 Runtime. "
-					"Continued usage of the plugin can cause instability within the editor.\r\n\r\n"
+	const FText& WarningMessage =
+		LOCTEXT("NDIRuntimeMissing",
+				"Cannot find \"Processing.NDI.Lib.x64.dll\" from the NDI 6 Runtime Directory. "
+				"Continued usage of the plugin can cause instability within the editor.\r\n\r\n"
 
-					"Please refer to the 'NDI IO Plugin for Unreal Engine Quickstart Guide' "
-					"for additional information related to installation instructions for this plugin.\r\n\r\n");
+				"Please refer to the 'NDI IO Plugin for Unreal Engine Quickstart Guide' "
+				"for additional information related to installation instructions for this plugin.\r\n\r\n");
 
-		// Open a message box, showing that things will not work since the NDI Runtime Directory cannot be found
-		if (FMessageDialog::Open(EAppMsgType::OkCancel, EAppReturnType::Ok, WarningMessage) == EAppReturnType::Ok)
-		{
-			FString URLResult = FString("");
-			FPlatformProcess::LaunchURL(*FString("https://ndi.video/sdk/"), nullptr, &URLResult);
-		}
+	// Open a message box, showing that things will not work since the NDI Runtime Directory cannot be found
+	if (FMessageDialog::Open(EAppMsgType::OkCancel, EAppReturnType::Ok, WarningMessage) == EAppReturnType::Ok)
+	{
+		FString URLResult = FString("");
+		FPlatformProcess::LaunchURL(*FString("https://ndi.video/sdk/"), nullptr, &URLResult);
+	}
 
 #endif
-#endif
-	}
 
+#elif PLATFORM_ANDROID
 
-	// supported platforms
-	SupportedPlatforms.Add(TEXT("Windows"));
-	SupportedPlatforms.Add(TEXT("Linux"));
-	SupportedPlatforms.Add(TEXT("LinuxAArch64"));
-	SupportedPlatforms.Add(TEXT("Android"));
-	// supported schemes
-	SupportedUriSchemes.Add(TEXT("ndiio"));
+	UE_LOG(LogTemp, Warning, TEXT("NDIIO Plugin: Detected Android platform. Verifying NDI integration."));
 
-	// register player factory
-	auto MediaModule = FModuleManager::LoadModulePtr<IMediaModule>("Media");
 
-	if (MediaModule != nullptr)
+
+#elif (PLATFORM_LINUX || PLATFORM_LINUXARM64)
+	// Write an error message to the log.
+	UE_LOG(LogLinux, Error,
+		   TEXT("Unable to load \"" NDILIB_LIBRARY_NAME "\" from the NDI 6 Runtime."));
+
+#if UE_EDITOR
+
+	const FText& WarningMessage =
+		LOCTEXT("NDIRuntimeMissing",
+				"Cannot find \"" NDILIB_LIBRARY_NAME "\" from the NDI 6 Runtime. "
+				"Continued usage of the plugin can cause instability within the editor.\r\n\r\n"
+
+				"Please refer to the 'NDI IO Plugin for Unreal Engine Quickstart Guide' "
+				"for additional information related to installation instructions for this plugin.\r\n\r\n");
+
+	// Open a message box, showing that things will not work since the NDI Runtime Directory cannot be found
+	if (FMessageDialog::Open(EAppMsgType::OkCancel, EAppReturnType::Ok, WarningMessage) == EAppReturnType::Ok)
 	{
-		MediaModule->RegisterPlayerFactory(*this);
+		FString URLResult = FString("");
+		FPlatformProcess::LaunchURL(*FString("https://ndi.video/sdk/"), nullptr, &URLResult);
 	}
 
-	FApp::SetUnfocusedVolumeMultiplier(1.f);
+#endif
+#endif
 }
 
 void FNDIIOPluginModule::ShutdownModule()
@@ -161,14 +243,28 @@ void FNDIIOPluginModule::ShutdownModule()
 	}
 
 
+	FNDIEventDispatcher::Shutdown();
+
+	// Let a preload which is still running finish, before unloading what it loaded
+	if (PreloadFuture.IsValid())
+		PreloadFuture.Wait();
+
 	if (NDIFinderService.IsValid())
 		NDIFinderService->Shutdown();
 
+	// Release what the senders and receivers handed over for teardown, while the library is still loaded
+	FNDIMediaSenderPool::Shutdown();
+	FNDIMediaReaper::Shutdown();
+
 	ShutdownModuleDependencies();
+
+	PluginModule = nullptr;
 }
 
 bool FNDIIOPluginModule::BeginBroadcastingActiveViewport()
 {
+	EnsureRuntimeLoaded();
+
 	// Ensure we have a valid service
 	if (NDIConnectionService.IsValid())
 	{
@@ -259,8 +355,28 @@ bool FNDIIOPluginModule::SupportsFeature(EMediaFeature Feature) const
 
 
 
+/**
+	The NDI library reads its discovery server from the 'ndi-config.v1.json' file in the directory named by the
+	'NDI_CONFIG_DIR' environment variable when it is initialized. A configuration made outside of the application
+	takes precedence
+*/
+void FNDIIOPluginModule::ConfigureDiscoveryServer()
+{
+	const FString DiscoveryServer = GetDefault<UNDIIOPluginSettings>()->DiscoveryServer.TrimStartAndEnd();
+	if (DiscoveryServer.IsEmpty() || !FPlatformMisc::GetEnvironmentVariable(TEXT("NDI_CONFIG_DIR")).IsEmpty())
+		return;
+
+	const FString ConfigDirectory = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("NDIIO")));
+	const FString Config = FString::Printf(TEXT("{ \"ndi\": { \"networks\": { \"discovery\": \"%s\" } } }"), *DiscoveryServer.ReplaceCharWithEscapedChar());
+
+	if (FFileHelper::SaveStringToFile(Config, *FPaths::Combine(ConfigDirectory, TEXT("ndi-config.v1.json"))))
+		FPlatformMisc::SetEnvironmentVar(TEXT("NDI_CONFIG_DIR"), *ConfigDirectory);
+}
+
 bool FNDIIOPluginModule::LoadModuleDependencies()
 {
+	ConfigureDiscoveryServer();
+
 #if PLATFORM_WINDOWS
 	// Get the Binaries File Location
 	const FString env_variable = TEXT(NDILIB_REDIST_FOLDER);
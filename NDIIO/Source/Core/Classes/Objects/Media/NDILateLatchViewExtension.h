@@ -0,0 +1,81 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <NDIIOPluginAPI.h>
+#include <SceneViewExtension.h>
+#include <RenderGraphBuilder.h>
+#include <RenderingThread.h>
+
+
+/**
+	A scene view extension which runs a latch function on the render thread right before the views (which may be
+	sampling an NDI video texture) are rendered, at most once per render frame
+*/
+class FNDILateLatchViewExtension : public FSceneViewExtensionBase
+{
+public:
+	FNDILateLatchViewExtension(const FAutoRegister& AutoRegister, TFunction<void()> InLatchFunction)
+		: FSceneViewExtensionBase(AutoRegister)
+		, LatchFunction(MoveTemp(InLatchFunction))
+	{}
+
+	virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) override {}
+	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override {}
+	virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override {}
+
+#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))	// 5.1 or later
+	virtual void PreRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily) override
+#elif (ENGINE_MAJOR_VERSION == 5)
+	virtual void PreRenderViewFamily_RenderThread(FRHICommandListImmediate& RHICmdList, FSceneViewFamily& InViewFamily) override
+#else
+	#error "Unsupported engine major version"
+#endif
+	{
+		LatchIfPending_RenderThread();
+	}
+
+	/**
+		Runs the latch function unless it already ran this frame. Several view families can be rendered in a single
+		frame (scene captures, editor viewports), and the end of the frame may call this when no view was rendered
+	*/
+	void LatchIfPending_RenderThread()
+	{
+		check(IsInRenderingThread());
+
+		if (LastLatchedFrameNumber == GFrameNumberRenderThread)
+			return;
+
+		LastLatchedFrameNumber = GFrameNumberRenderThread;
+
+		if (LatchFunction)
+			LatchFunction();
+	}
+
+	/** Stops calling the latch function; view families gathered earlier may still hold on to this extension */
+	void Detach_RenderThread()
+	{
+		LatchFunction.Reset();
+	}
+
+	/** Detaches the extension on the render thread, after any work already queued which may still use it */
+	static void Release(TSharedPtr<FNDILateLatchViewExtension, ESPMode::ThreadSafe>& InExtension)
+	{
+		if (InExtension.IsValid())
+		{
+			ENQUEUE_RENDER_COMMAND(NDILateLatchViewExtension_Detach)([OldExtension = MoveTemp(InExtension)](FRHICommandListImmediate& RHICmdList)
+			{
+				OldExtension->Detach_RenderThread();
+			});
+		}
+	}
+
+private:
+	TFunction<void()> LatchFunction;
+	uint32 LastLatchedFrameNumber = MAX_uint32;
+};
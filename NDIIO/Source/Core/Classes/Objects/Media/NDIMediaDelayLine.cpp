@@ -0,0 +1,256 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include "NDIMediaDelayLine.h"
+
+
+/** The highest frame rate the video ring is sized for, faster sources are delayed by fewer frames */
+static constexpr double MaxDelayedFrameRate = 120.0;
+
+void FNDIMediaDelayLine::SetDelay(double InDelaySeconds, double MaxDelaySeconds, int64 InMaxVideoBytes)
+{
+	const double NewDelay = FMath::Clamp(InDelaySeconds, 0.0, FMath::Max(MaxDelaySeconds, 0.0));
+
+	// Size the ring for the delay, plus the frame being displayed and the one arriving, so that the render
+	// thread never has to allocate
+	const int32 NumSlots = (NewDelay > 0.0) ? FMath::CeilToInt(NewDelay * MaxDelayedFrameRate) + 2 : 0;
+
+	FScopeLock Lock(&VideoSyncContext);
+
+	MaxVideoBytes.store(FMath::Max<int64>(InMaxVideoBytes, 0));
+	DelaySeconds.store(NewDelay);
+
+	if (NumSlots != VideoSlots.Num())
+		ResizeVideo(NumSlots);
+}
+
+int64 FNDIMediaDelayLine::GetVideoFrameSize(const NDIlib_video_frame_v2_t& InFrame)
+{
+	const int64 PlaneSize = int64(InFrame.line_stride_in_bytes) * InFrame.yres;
+
+	switch (InFrame.FourCC)
+	{
+		case NDIlib_FourCC_video_type_UYVA:
+			return PlaneSize + int64(InFrame.xres) * InFrame.yres;
+		case NDIlib_FourCC_video_type_P216:
+			return PlaneSize * 2;
+		case NDIlib_FourCC_video_type_PA16:
+			return PlaneSize * 3;
+		case NDIlib_FourCC_video_type_YV12:
+		case NDIlib_FourCC_video_type_I420:
+		case NDIlib_FourCC_video_type_NV12:
+			return PlaneSize + PlaneSize / 2;
+		default:
+			return PlaneSize;
+	}
+}
+
+void FNDIMediaDelayLine::ResizeVideo(int32 InNumSlots)
+{
+	TArray<FVideoSlot> NewSlots;
+	NewSlots.SetNum(InNumSlots);
+
+	const int32 NumKept = FMath::Min(VideoCount, InNumSlots);
+	for (int32 Index = 0; Index < NumKept; ++Index)
+		NewSlots[Index] = MoveTemp(VideoSlots[(VideoHead + VideoCount - NumKept + Index) % VideoSlots.Num()]);
+
+	// The frames which were not kept are released here, with the old ring
+	VideoSlots = MoveTemp(NewSlots);
+	VideoHead = 0;
+	VideoCount = NumKept;
+}
+
+FNDIMediaVideoFramePtr FNDIMediaDelayLine::DelayVideo(const FNDIMediaVideoFrameRef& InFrame, double Now)
+{
+	FScopeLock Lock(&VideoSyncContext);
+
+	const double Delay = DelaySeconds.load();
+
+	if ((Delay <= 0.0) || (VideoSlots.Num() == 0))
+	{
+		VideoDelayLimit.store(-1.0);
+		return InFrame;
+	}
+
+	// The frame-sync repeats its last frame until a new one arrives
+	const bool bIsNewFrame = (VideoCount == 0) || (VideoSlots[(VideoHead + VideoCount - 1) % VideoSlots.Num()].Frame != InFrame);
+
+	// Hold no more frames than the budget allows, which limits the delay of large frames
+	const int64 FrameSize = FMath::Max<int64>(GetVideoFrameSize(InFrame->GetFrame()), 1);
+	const int32 MaxFrames = (int32)FMath::Clamp<int64>(MaxVideoBytes.load() / FrameSize, 2, VideoSlots.Num());
+
+	if (bIsNewFrame)
+	{
+		while (VideoCount >= MaxFrames)
+		{
+			VideoSlots[VideoHead].Frame.Reset();
+			VideoHead = (VideoHead + 1) % VideoSlots.Num();
+			--VideoCount;
+		}
+
+		FVideoSlot& Slot = VideoSlots[(VideoHead + VideoCount) % VideoSlots.Num()];
+		Slot.Frame = InFrame;
+		Slot.ArrivalTime = Now;
+		++VideoCount;
+
+		// Let the audio follow, and tell about it once, when the budget starts limiting the delay
+		const FFrameRate FrameRate = InFrame->GetFrameRate();
+		const double FramePeriod = ((FrameRate.Numerator > 0) && (FrameRate.Denominator > 0)) ? FrameRate.AsInterval() : (1.0 / 60.0);
+		const double DelayLimit = (MaxFrames - 1) * FramePeriod;
+		const bool bIsLimited = (DelayLimit < Delay);
+
+		if (bIsLimited && (VideoDelayLimit.load() < 0.0))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("NDIIO Plugin: A delay of %.0f ms needs more than the %lld MB of delay memory at %dx%d, the delay is limited to %.0f ms."),
+				   Delay * 1000.0, MaxVideoBytes.load() / (1024 * 1024), InFrame->GetResolution().X, InFrame->GetResolution().Y, DelayLimit * 1000.0);
+		}
+
+		VideoDelayLimit.store(bIsLimited ? DelayLimit : -1.0);
+	}
+
+	// Find the newest frame which is old enough, everything older than it is no longer needed.  When the ring is
+	// full, the oldest frame is as old as the budget allows and is presented instead
+	int32 DelayedIndex = (VideoCount >= MaxFrames) ? 0 : -1;
+	for (int32 Index = 0; Index < VideoCount; ++Index)
+	{
+		if (VideoSlots[(VideoHead + Index) % VideoSlots.Num()].ArrivalTime <= (Now - Delay))
+			DelayedIndex = Index;
+		else
+			break;
+	}
+
+	if (DelayedIndex < 0)
+		return nullptr;
+
+	for (int32 Index = 0; Index < DelayedIndex; ++Index)
+		VideoSlots[(VideoHead + Index) % VideoSlots.Num()].Frame.Reset();
+
+	VideoHead = (VideoHead + DelayedIndex) % VideoSlots.Num();
+	VideoCount -= DelayedIndex;
+
+	return VideoSlots[VideoHead].Frame;
+}
+
+double FNDIMediaDelayLine::GetAudioDelay() const
+{
+	const double Delay = DelaySeconds.load();
+	const double Limit = VideoDelayLimit.load();
+
+	return (Limit >= 0.0) ? FMath::Min(Delay, Limit) : Delay;
+}
+
+bool FNDIMediaDelayLine::DelayAudio(EAudioConsumer Consumer, const NDIlib_audio_frame_v2_t& InFrame, NDIlib_audio_frame_v2_t& OutFrame)
+{
+	FAudioRing& Ring = AudioRings[(int32)Consumer];
+
+	const uint32 ResetCount = AudioResetCount.load();
+	if (Ring.ResetCount != ResetCount)
+	{
+		Ring = FAudioRing();
+		Ring.ResetCount = ResetCount;
+	}
+
+	const double Delay = GetAudioDelay();
+
+	if (Delay <= 0.0)
+	{
+		// Nothing to delay, so don't hold on to any memory either
+		if (Ring.Capacity > 0)
+		{
+			Ring = FAudioRing();
+			Ring.ResetCount = ResetCount;
+		}
+		OutFrame = InFrame;
+		return true;
+	}
+
+	if ((InFrame.p_data == nullptr) || (InFrame.no_samples <= 0) || (InFrame.no_channels <= 0))
+		return false;
+
+	// A change of format invalidates the samples we hold
+	if ((InFrame.no_channels != Ring.Channels) || (InFrame.sample_rate != Ring.SampleRate))
+	{
+		Ring = FAudioRing();
+		Ring.ResetCount = ResetCount;
+		Ring.Channels = InFrame.no_channels;
+		Ring.SampleRate = InFrame.sample_rate;
+	}
+
+	const int32 DelaySamples = FMath::CeilToInt(Delay * Ring.SampleRate);
+	const int32 RequiredCapacity = DelaySamples + InFrame.no_samples * 2;
+
+	if (Ring.Capacity < RequiredCapacity)
+	{
+		// Grow the ring, keeping the samples in order
+		TArray<float> NewSamples;
+		NewSamples.SetNumZeroed(RequiredCapacity * Ring.Channels);
+		for (int32 Channel = 0; Channel < Ring.Channels; ++Channel)
+		{
+			for (int32 Index = 0; Index < Ring.Count; ++Index)
+				NewSamples[Channel * RequiredCapacity + Index] = Ring.Samples[Channel * Ring.Capacity + (Ring.Head + Index) % Ring.Capacity];
+		}
+		Ring.Samples = MoveTemp(NewSamples);
+		Ring.Capacity = RequiredCapacity;
+		Ring.Head = 0;
+	}
+
+	// When the delay was reduced, skip the samples which are now too old
+	const int32 ExcessSamples = Ring.Count - DelaySamples;
+	if (ExcessSamples > 0)
+	{
+		Ring.Head = (Ring.Head + ExcessSamples) % Ring.Capacity;
+		Ring.Count -= ExcessSamples;
+	}
+
+	// Append the new samples
+	for (int32 Channel = 0; Channel < Ring.Channels; ++Channel)
+	{
+		const float* Source = reinterpret_cast<const float*>(reinterpret_cast<const uint8*>(InFrame.p_data) + Channel * InFrame.channel_stride_in_bytes);
+		float* Destination = Ring.Samples.GetData() + Channel * Ring.Capacity;
+		for (int32 Index = 0; Index < InFrame.no_samples; ++Index)
+			Destination[(Ring.Head + Ring.Count + Index) % Ring.Capacity] = Source[Index];
+	}
+	Ring.Count += InFrame.no_samples;
+
+	// Still filling up to the requested delay
+	if (Ring.Count < (DelaySamples + InFrame.no_samples))
+		return false;
+
+	// Hand out as many samples as came in, from 'Delay' seconds ago
+	Ring.Output.SetNumUninitialized(InFrame.no_samples * Ring.Channels);
+	for (int32 Channel = 0; Channel < Ring.Channels; ++Channel)
+	{
+		const float* Source = Ring.Samples.GetData() + Channel * Ring.Capacity;
+		float* Destination = Ring.Output.GetData() + Channel * InFrame.no_samples;
+		for (int32 Index = 0; Index < InFrame.no_samples; ++Index)
+			Destination[Index] = Source[(Ring.Head + Index) % Ring.Capacity];
+	}
+	Ring.Head = (Ring.Head + InFrame.no_samples) % Ring.Capacity;
+	Ring.Count -= InFrame.no_samples;
+
+	OutFrame = InFrame;
+	OutFrame.p_data = Ring.Output.GetData();
+	OutFrame.channel_stride_in_bytes = InFrame.no_samples * sizeof(float);
+
+	return true;
+}
+
+void FNDIMediaDelayLine::ResetVideo()
+{
+	FScopeLock Lock(&VideoSyncContext);
+
+	for (FVideoSlot& Slot : VideoSlots)
+		Slot.Frame.Reset();
+	VideoHead = 0;
+	VideoCount = 0;
+	VideoDelayLimit.store(-1.0);
+}
+
+void FNDIMediaDelayLine::ResetAudio()
+{
+	++AudioResetCount;
+}
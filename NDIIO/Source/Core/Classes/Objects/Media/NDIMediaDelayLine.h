@@ -0,0 +1,112 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <NDIIOPluginAPI.h>
+
+#include <Objects/Media/NDIMediaVideoFrame.h>
+
+#include <atomic>
+
+
+/**
+	Delays the video and audio frames of a receiver by a configurable amount of time.  The video frames are held by
+	reference rather than copied, so frames of any format are delayed, and the ring holding them is sized when the
+	delay is set.  The frames held are bounded by a memory budget, which limits the delay of large frames.  Every
+	consumer of the audio has a ring of its own, as each of them captures its samples from the frame-sync.  The delay
+	can be changed at any time; the video side and each audio consumer are expected to be called from a single thread
+	at a time.
+*/
+class FNDIMediaDelayLine
+{
+public:
+	/** The consumers of the audio of a receiver */
+	enum class EAudioConsumer : uint8
+	{
+		SoundWaves,
+		CaptureEvents,
+		Num
+	};
+
+	/**
+		Sets the delay in seconds, clamped to 'MaxDelaySeconds', and the memory (in bytes) which the delayed video
+		frames may use.  Can be called from any thread
+	*/
+	void SetDelay(double InDelaySeconds, double MaxDelaySeconds, int64 InMaxVideoBytes);
+
+	/** Returns the delay in seconds */
+	double GetDelay() const
+	{
+		return DelaySeconds.load();
+	}
+
+	/**
+		Adds a video frame to the delay line, and returns the frame which arrived 'Delay' seconds before 'Now'.
+		Returns 'InFrame' itself if there is no delay, or nullptr if no frame is old enough yet.
+	*/
+	FNDIMediaVideoFramePtr DelayVideo(const FNDIMediaVideoFrameRef& InFrame, double Now);
+
+	/**
+		Adds the samples of an audio frame to the ring of 'Consumer', and fills 'OutFrame' with the same number of
+		samples from 'Delay' seconds earlier.  'OutFrame' is 'InFrame' itself if there is no delay.  Returns false
+		while the delay line is still filling up.  The samples of 'OutFrame' stay valid until the next call.
+	*/
+	bool DelayAudio(EAudioConsumer Consumer, const NDIlib_audio_frame_v2_t& InFrame, NDIlib_audio_frame_v2_t& OutFrame);
+
+	/** Releases the video frames */
+	void ResetVideo();
+
+	/** Has every audio consumer drop its samples with its next call, without waiting on any of them */
+	void ResetAudio();
+
+private:
+	/** Returns the size of the pixel data of a frame */
+	static int64 GetVideoFrameSize(const NDIlib_video_frame_v2_t& InFrame);
+
+	/** Resizes the video ring, keeping the newest frames in order. Called with the video lock held */
+	void ResizeVideo(int32 InNumSlots);
+
+	/** Returns the delay applied to the audio, which follows the video when the video delay is limited by the budget */
+	double GetAudioDelay() const;
+
+	struct FVideoSlot
+	{
+		FNDIMediaVideoFramePtr Frame;
+		double ArrivalTime = 0.0;
+	};
+
+	/** Planar audio samples, oldest first starting at 'Head' in every channel */
+	struct FAudioRing
+	{
+		TArray<float> Samples;
+		TArray<float> Output;
+		int32 Channels = 0;
+		int32 SampleRate = 0;
+		int32 Capacity = 0;
+		int32 Head = 0;
+		int32 Count = 0;
+		uint32 ResetCount = 0;
+	};
+
+	std::atomic<double> DelaySeconds { 0.0 };
+	std::atomic<int64> MaxVideoBytes { 0 };
+
+	/** The longest delay the budget allows for the video frames last seen, or a negative value if it's not limited */
+	std::atomic<double> VideoDelayLimit { -1.0 };
+
+	// Video frames, oldest first starting at 'VideoHead'
+	FCriticalSection VideoSyncContext;
+	TArray<FVideoSlot> VideoSlots;
+	int32 VideoHead = 0;
+	int32 VideoCount = 0;
+
+	FAudioRing AudioRings[(int32)EAudioConsumer::Num];
+
+	/** Counts the resets of the audio, each consumer drops its samples once it sees a count it hasn't seen */
+	std::atomic<uint32> AudioResetCount { 0 };
+};
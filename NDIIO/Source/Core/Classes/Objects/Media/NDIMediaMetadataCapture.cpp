@@ -0,0 +1,220 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include "NDIMediaMetadataCapture.h"
+
+#include <HAL/PlatformProcess.h>
+
+
+FNDIMediaMetadataCapture::FNDIMediaMetadataCapture(FCapturedFunction&& InOnCaptured)
+	: OnCaptured(MoveTemp(InOnCaptured))
+{
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	p_RunnableThread = FRunnableThread::Create(this, TEXT("FNDIMediaMetadataCapture"), 0, TPri_BelowNormal);
+}
+
+FNDIMediaMetadataCapture::~FNDIMediaMetadataCapture()
+{
+	if (p_RunnableThread != nullptr)
+	{
+		p_RunnableThread->Kill(true);
+		delete p_RunnableThread;
+		p_RunnableThread = nullptr;
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+}
+
+void FNDIMediaMetadataCapture::ClearCapturedFunction()
+{
+	FScopeLock Lock(&CapturedSyncContext);
+	OnCaptured = nullptr;
+}
+
+void FNDIMediaMetadataCapture::SetInstance(const TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe>& InInstance)
+{
+	{
+		FScopeLock Lock(&CaptureSyncContext);
+		Instance = InInstance;
+	}
+
+	WakeEvent->Trigger();
+}
+
+void FNDIMediaMetadataCapture::SetCapacity(int32 InCapacity)
+{
+	Capacity = FMath::Max(InCapacity, 1);
+}
+
+void FNDIMediaMetadataCapture::SetWantsAllElements(bool bInWantsAllElements)
+{
+	bWantsAllElements = bInWantsAllElements;
+}
+
+void FNDIMediaMetadataCapture::Subscribe(FName ElementName)
+{
+	FScopeLock Lock(&CaptureSyncContext);
+	SubscribedElements.Add(ElementName);
+}
+
+void FNDIMediaMetadataCapture::Unsubscribe(FName ElementName)
+{
+	FScopeLock Lock(&CaptureSyncContext);
+	SubscribedElements.Remove(ElementName);
+}
+
+bool FNDIMediaMetadataCapture::Dequeue(FNDIMediaMetadataFrame& OutFrame)
+{
+	if (!Frames.Dequeue(OutFrame))
+		return false;
+
+	--NumFrames;
+	return true;
+}
+
+FName FNDIMediaMetadataCapture::GetRootElementName(const ANSICHAR* Data, int32 Length)
+{
+	const ANSICHAR* NameStart = nullptr;
+	int32 NameLength = 0;
+
+	// Only look the name up; a name which is not known yet cannot have been subscribed to
+	if (FindRootElement(Data, Length, NameStart, NameLength))
+		return FName(NameLength, NameStart, FNAME_Find);
+
+	return NAME_None;
+}
+
+FString FNDIMediaMetadataCapture::GetRootElementString(const ANSICHAR* Data, int32 Length)
+{
+	const ANSICHAR* NameStart = nullptr;
+	int32 NameLength = 0;
+
+	if (FindRootElement(Data, Length, NameStart, NameLength))
+		return FString(NameLength, NameStart);
+
+	return FString();
+}
+
+bool FNDIMediaMetadataCapture::FindRootElement(const ANSICHAR* Data, int32 Length, const ANSICHAR*& OutNameStart, int32& OutNameLength)
+{
+	const ANSICHAR* Current = Data;
+	const ANSICHAR* End = Data + Length;
+
+	while (Current < End)
+	{
+		// Skip the whitespace between the markup
+		while ((Current < End) && FChar::IsWhitespace(static_cast<TCHAR>(*Current)))
+			++Current;
+
+		if ((Current >= End) || (*Current != '<'))
+			break;
+		++Current;
+
+		// Skip the declaration, processing instructions and comments before the root element
+		if ((Current < End) && ((*Current == '?') || (*Current == '!')))
+		{
+			while ((Current < End) && (*Current != '>'))
+				++Current;
+			++Current;
+			continue;
+		}
+
+		const ANSICHAR* NameStart = Current;
+		while ((Current < End) && (*Current != '>') && (*Current != '/') && !FChar::IsWhitespace(static_cast<TCHAR>(*Current)))
+			++Current;
+
+		if (Current > NameStart)
+		{
+			OutNameStart = NameStart;
+			OutNameLength = static_cast<int32>(Current - NameStart);
+			return true;
+		}
+		break;
+	}
+
+	return false;
+}
+
+/** FRunnable Interface implementation for 'Run' */
+uint32 FNDIMediaMetadataCapture::Run()
+{
+	static const uint32 capture_wait_time = 100;
+
+	while (bIsThreadRunning)
+	{
+		TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> CaptureInstance;
+		{
+			FScopeLock Lock(&CaptureSyncContext);
+			CaptureInstance = Instance;
+		}
+
+		if (!CaptureInstance.IsValid() || (CaptureInstance->GetReceiveInstance() == nullptr))
+		{
+			WakeEvent->Wait(capture_wait_time);
+			continue;
+		}
+
+		// Wait up to 'capture_wait_time' (in milliseconds) for a metadata frame
+		NDIlib_metadata_frame_t metadata;
+		if (NDIlib_recv_capture_v3(CaptureInstance->GetReceiveInstance(), nullptr, nullptr, &metadata, capture_wait_time) == NDIlib_frame_type_metadata)
+		{
+			{
+				FScopeLock Lock(&CapturedSyncContext);
+				if (OnCaptured)
+					OnCaptured(metadata);
+			}
+
+			if ((metadata.p_data != nullptr) && (metadata.length > 0))
+			{
+				const int32 Length = FCStringAnsi::Strlen(metadata.p_data);
+				const FName ElementName = GetRootElementName(metadata.p_data, Length);
+
+				if (IsWanted(ElementName))
+				{
+					if (NumFrames.load() < Capacity.load())
+					{
+						FNDIMediaMetadataFrame Frame;
+						Frame.ElementName = ElementName;
+						Frame.Timecode = metadata.timecode;
+						Frame.Data.Append(metadata.p_data, Length + 1);
+
+						++NumFrames;
+						Frames.Enqueue(MoveTemp(Frame));
+					}
+					else
+					{
+						++DroppedFrames;
+					}
+				}
+			}
+
+			NDIlib_recv_free_metadata(CaptureInstance->GetReceiveInstance(), &metadata);
+		}
+	}
+
+	return 0;
+}
+
+/** FRunnable Interface implementation for 'Stop' */
+void FNDIMediaMetadataCapture::Stop()
+{
+	bIsThreadRunning = false;
+	WakeEvent->Trigger();
+}
+
+bool FNDIMediaMetadataCapture::IsWanted(FName ElementName) const
+{
+	if (bWantsAllElements.load())
+		return true;
+
+	if (ElementName.IsNone())
+		return false;
+
+	FScopeLock Lock(&CaptureSyncContext);
+	return SubscribedElements.Contains(ElementName);
+}
@@ -0,0 +1,101 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Containers/Queue.h>
+#include <HAL/Runnable.h>
+#include <HAL/RunnableThread.h>
+#include <Templates/Function.h>
+
+#include <Objects/Media/NDIMediaVideoFrame.h>
+
+#include <atomic>
+
+
+/**
+	A metadata frame as captured, kept in the UTF-8 it was received in
+*/
+struct FNDIMediaMetadataFrame
+{
+	FName ElementName;
+	int64 Timecode = 0;
+	TArray<ANSICHAR> Data;
+};
+
+/**
+	Captures the metadata frames of a receiver on its own thread, and queues those which are wanted for the game thread
+	to pick up.  A frame is wanted when its root element has been subscribed to, or when all frames are; others are
+	dropped without being decoded.  The queue is bounded, frames which arrive while it is full are dropped.
+*/
+class FNDIMediaMetadataCapture : public FRunnable
+{
+public:
+	using FCapturedFunction = TFunction<void(const NDIlib_metadata_frame_t&)>;
+
+	/** 'InOnCaptured' is called on the capture thread for every frame captured, before it is filtered */
+	FNDIMediaMetadataCapture(FCapturedFunction&& InOnCaptured);
+	virtual ~FNDIMediaMetadataCapture();
+
+	/** Stops calling the captured function; once this returns it is not being called anymore */
+	void ClearCapturedFunction();
+
+	/** Changes the receiver to capture from, or stops capturing with nullptr */
+	void SetInstance(const TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe>& InInstance);
+
+	/** Sets the number of frames which can be queued */
+	void SetCapacity(int32 InCapacity);
+
+	/** Sets whether all frames are wanted, whatever their root element */
+	void SetWantsAllElements(bool bInWantsAllElements);
+
+	void Subscribe(FName ElementName);
+	void Unsubscribe(FName ElementName);
+
+	/** Takes the next queued frame. Called from a single thread */
+	bool Dequeue(FNDIMediaMetadataFrame& OutFrame);
+
+	/** The number of frames dropped because the queue was full */
+	int64 GetDroppedFrames() const { return DroppedFrames.load(); }
+
+	/** Returns the name of the root element of an XML document, or NAME_None if no element was ever subscribed by that name */
+	static FName GetRootElementName(const ANSICHAR* Data, int32 Length);
+
+	/** Returns the name of the root element of an XML document, or an empty string if it has none */
+	static FString GetRootElementString(const ANSICHAR* Data, int32 Length);
+
+private:
+	/** FRunnable Interface implementation for 'Run' */
+	virtual uint32 Run() override;
+
+	/** FRunnable Interface implementation for 'Stop' */
+	virtual void Stop() override;
+
+	bool IsWanted(FName ElementName) const;
+
+	/** Finds the name of the root element of an XML document, returns false if it has none */
+	static bool FindRootElement(const ANSICHAR* Data, int32 Length, const ANSICHAR*& OutNameStart, int32& OutNameLength);
+
+private:
+	FCapturedFunction OnCaptured;
+	FCriticalSection CapturedSyncContext;
+
+	TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> Instance;
+	TSet<FName> SubscribedElements;
+	mutable FCriticalSection CaptureSyncContext;
+
+	TQueue<FNDIMediaMetadataFrame, EQueueMode::Spsc> Frames;
+	std::atomic<int32> NumFrames { 0 };
+	std::atomic<int32> Capacity { 1024 };
+	std::atomic<int64> DroppedFrames { 0 };
+	std::atomic<bool> bWantsAllElements { false };
+
+	FEvent* WakeEvent = nullptr;
+	FRunnableThread* p_RunnableThread = nullptr;
+	std::atomic<bool> bIsThreadRunning { true };
+};
@@ -0,0 +1,154 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include "NDIMediaReaper.h"
+
+#include <HAL/PlatformProcess.h>
+#include <RenderingThread.h>
+
+
+/** The reaper, created on first use and destroyed on module shutdown */
+static FNDIMediaReaper* NDI_MEDIA_REAPER = nullptr;
+static FCriticalSection NDI_MEDIA_REAPER_SYNC_CONTEXT;
+static bool bIsNDIMediaReaperShutdown = false;
+
+
+FNDIMediaReaper::FNDIMediaReaper()
+{
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	p_RunnableThread = FRunnableThread::Create(this, TEXT("FNDIMediaReaper"), 0, TPri_BelowNormal);
+}
+
+FNDIMediaReaper::~FNDIMediaReaper()
+{
+	if (p_RunnableThread != nullptr)
+	{
+		p_RunnableThread->Kill(true);
+		delete p_RunnableThread;
+		p_RunnableThread = nullptr;
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+}
+
+void FNDIMediaReaper::Retire(TUniqueFunction<void()>&& InRelease)
+{
+	RetireResource([Release = MoveTemp(InRelease)](bool bForce) mutable
+	{
+		Release();
+		return true;
+	});
+}
+
+void FNDIMediaReaper::RetireReceiverInstance(TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe>&& InInstance)
+{
+	if (!InInstance.IsValid())
+		return;
+
+	// Captured frames hold on to the instance, so it is destroyed once the reaper holds the only reference
+	RetireResource([Instance = MoveTemp(InInstance)](bool bForce) mutable
+	{
+		if (!bForce && !Instance.IsUnique())
+			return false;
+
+		// When forced, frames still held elsewhere may outlive the NDI library, so destroy the SDK objects now and
+		// let those frames release nothing
+		Instance->Invalidate();
+		Instance.Reset();
+		return true;
+	});
+}
+
+void FNDIMediaReaper::RetireResource(FRetiredResource&& InResource)
+{
+	{
+		FScopeLock Lock(&NDI_MEDIA_REAPER_SYNC_CONTEXT);
+
+		if (!bIsNDIMediaReaperShutdown)
+		{
+			if (NDI_MEDIA_REAPER == nullptr)
+				NDI_MEDIA_REAPER = new FNDIMediaReaper();
+
+			{
+				FScopeLock IncomingLock(&NDI_MEDIA_REAPER->IncomingSyncContext);
+				NDI_MEDIA_REAPER->Incoming.Add(MoveTemp(InResource));
+			}
+
+			NDI_MEDIA_REAPER->WakeEvent->Trigger();
+			return;
+		}
+	}
+
+	// Past shutdown nothing is left to wait for
+	InResource(true);
+}
+
+void FNDIMediaReaper::Shutdown()
+{
+	check(IsInGameThread());
+
+	FNDIMediaReaper* Reaper = nullptr;
+	{
+		FScopeLock Lock(&NDI_MEDIA_REAPER_SYNC_CONTEXT);
+
+		bIsNDIMediaReaperShutdown = true;
+		Reaper = NDI_MEDIA_REAPER;
+		NDI_MEDIA_REAPER = nullptr;
+	}
+
+	if (Reaper != nullptr)
+	{
+		// Wait for the thread, then release everything it did not get to. The release jobs may queue render
+		// commands, which have to run before the NDI library is unloaded
+		Reaper->Stop();
+		delete Reaper;
+
+		FlushRenderingCommands();
+	}
+}
+
+/** FRunnable Interface implementation for 'Run' */
+uint32 FNDIMediaReaper::Run()
+{
+	static const uint32 poll_wait_time = 10;
+
+	while (bIsThreadRunning)
+	{
+		ReleasePending(false);
+
+		// Poll while waiting on resources which are still referenced, otherwise sleep until something is retired
+		WakeEvent->Wait(Pending.Num() > 0 ? poll_wait_time : 1000);
+	}
+
+	ReleasePending(true);
+
+	return 0;
+}
+
+/** FRunnable Interface implementation for 'Stop' */
+void FNDIMediaReaper::Stop()
+{
+	bIsThreadRunning = false;
+	WakeEvent->Trigger();
+}
+
+void FNDIMediaReaper::ReleasePending(bool bForce)
+{
+	{
+		FScopeLock Lock(&IncomingSyncContext);
+
+		Pending.Append(MoveTemp(Incoming));
+		Incoming.Reset();
+	}
+
+	for (int32 iter = Pending.Num() - 1; iter >= 0; --iter)
+	{
+		if (Pending[iter](bForce))
+			Pending.RemoveAtSwap(iter);
+	}
+}
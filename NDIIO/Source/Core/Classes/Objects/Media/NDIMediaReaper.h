@@ -0,0 +1,66 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <HAL/Runnable.h>
+#include <HAL/RunnableThread.h>
+#include <Templates/Function.h>
+
+#include <atomic>
+
+#include <Objects/Media/NDIMediaVideoFrame.h>
+
+
+/**
+	Releases the SDK instances and GPU resources of senders and receivers on a background thread, so that tearing
+	them down never blocks the game thread.  A retired resource is released once it reports that nothing references
+	it anymore.
+*/
+class FNDIMediaReaper : public FRunnable
+{
+public:
+	/** Hands a release job to the reaper thread, or runs it on the calling thread once the reaper has shut down */
+	static void Retire(TUniqueFunction<void()>&& InRelease);
+
+	/** Destroys a receiver and its frame-sync, once no captured frames reference them anymore */
+	static void RetireReceiverInstance(TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe>&& InInstance);
+
+	/** Stops the reaper, and releases whatever it still holds. Called from the game thread on module shutdown */
+	static void Shutdown();
+
+private:
+	/** Releases the resource and returns true, or returns false while it is still referenced and not forced */
+	using FRetiredResource = TUniqueFunction<bool(bool bForce)>;
+
+	static void RetireResource(FRetiredResource&& InResource);
+
+	FNDIMediaReaper();
+	virtual ~FNDIMediaReaper();
+
+	/** FRunnable Interface implementation for 'Run' */
+	virtual uint32 Run() override;
+
+	/** FRunnable Interface implementation for 'Stop' */
+	virtual void Stop() override;
+
+	/** Releases the resources which are releasable, or all of them when 'bForce' is set */
+	void ReleasePending(bool bForce);
+
+private:
+	/** The resources handed to the reaper, which the reaper thread has not picked up yet */
+	TArray<FRetiredResource> Incoming;
+	FCriticalSection IncomingSyncContext;
+
+	/** The resources the reaper thread is waiting on, only accessed by that thread */
+	TArray<FRetiredResource> Pending;
+
+	FEvent* WakeEvent = nullptr;
+	FRunnableThread* p_RunnableThread = nullptr;
+	std::atomic<bool> bIsThreadRunning { true };
+};
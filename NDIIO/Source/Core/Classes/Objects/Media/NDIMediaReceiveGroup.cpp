@@ -0,0 +1,225 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Objects/Media/NDIMediaReceiveGroup.h>
+#include <Misc/CoreDelegates.h>
+#include <HAL/PlatformTime.h>
+
+#include "NDILateLatchViewExtension.h"
+
+
+/**
+	Initializes the members for group use and starts presenting their video frames together
+*/
+void UNDIMediaReceiveGroup::Start()
+{
+	Stop();
+
+	{
+		FScopeLock Lock(&GroupSyncContext);
+
+		MemberStates.SetNum(Members.Num());
+		for (int32 MemberIndex = 0; MemberIndex < Members.Num(); ++MemberIndex)
+		{
+			if (IsValid(Members[MemberIndex]))
+				Members[MemberIndex]->Initialize(UNDIMediaReceiver::EUsage::Grouped);
+
+			ResetMemberState(MemberStates[MemberIndex], Members[MemberIndex]);
+		}
+
+		bIsStarted = true;
+	}
+
+	// Latch the frames of all members just before the views render
+	if (GEngine != nullptr)
+	{
+		LateLatchViewExtension = FSceneViewExtensions::NewExtension<FNDILateLatchViewExtension>([this]()
+		{
+			this->LatchMembers_RenderThread();
+		});
+	}
+
+	// If no view is rendered in a frame, the members are latched at the end of it instead
+	FrameEndRTHandle = FCoreDelegates::OnEndFrameRT.AddLambda([this, ViewExtension = LateLatchViewExtension]()
+	{
+		if (ViewExtension.IsValid())
+			ViewExtension->LatchIfPending_RenderThread();
+		else
+			this->LatchMembers_RenderThread();
+	});
+}
+
+/**
+	Stops presenting the video frames of the members
+*/
+void UNDIMediaReceiveGroup::Stop()
+{
+	FCoreDelegates::OnEndFrameRT.Remove(FrameEndRTHandle);
+	FrameEndRTHandle.Reset();
+
+	FNDILateLatchViewExtension::Release(LateLatchViewExtension);
+
+	FScopeLock Lock(&GroupSyncContext);
+
+	MemberStates.Empty();
+
+	bIsStarted = false;
+}
+
+/**
+	Adds a receiver to the group. The receiver should not have been initialized for standalone use
+*/
+void UNDIMediaReceiveGroup::AddMember(UNDIMediaReceiver* Receiver)
+{
+	if (!IsValid(Receiver))
+		return;
+
+	FScopeLock Lock(&GroupSyncContext);
+
+	if (Members.Contains(Receiver))
+		return;
+
+	Members.Add(Receiver);
+
+	if (bIsStarted)
+	{
+		Receiver->Initialize(UNDIMediaReceiver::EUsage::Grouped);
+
+		ResetMemberState(MemberStates.AddDefaulted_GetRef(), Receiver);
+	}
+}
+
+/**
+	Removes a receiver from the group
+*/
+void UNDIMediaReceiveGroup::RemoveMember(UNDIMediaReceiver* Receiver)
+{
+	FScopeLock Lock(&GroupSyncContext);
+
+	Members.Remove(Receiver);
+	MemberStates.RemoveAll([Receiver](const FMemberState& MemberState) { return MemberState.Receiver == Receiver; });
+}
+
+/**
+	Returns how far (in milliseconds) the source time of the frame last presented by 'Receiver' was from the
+	common source time of the group
+*/
+float UNDIMediaReceiveGroup::GetMemberSkew(UNDIMediaReceiver* Receiver) const
+{
+	FScopeLock Lock(&GroupSyncContext);
+
+	for (const FMemberState& MemberState : MemberStates)
+	{
+		if (MemberState.Receiver == Receiver)
+			return MemberState.Skew;
+	}
+
+	return 0.f;
+}
+
+void UNDIMediaReceiveGroup::BeginDestroy()
+{
+	Stop();
+
+	Super::BeginDestroy();
+}
+
+void UNDIMediaReceiveGroup::ResetMemberState(FMemberState& MemberState, UNDIMediaReceiver* Receiver) const
+{
+	MemberState.Receiver = Receiver;
+	MemberState.Frames.Reset();
+	MemberState.Frames.SetNum(FMath::Clamp(BufferedFrames, 1, 8));
+	MemberState.NewestFrame = -1;
+	MemberState.NumFrames = 0;
+	MemberState.LastArrivalTime = 0.0;
+	MemberState.Skew = 0.f;
+}
+
+/**
+	Buffers the newest (delayed) frame of every member, then presents for every member the buffered frame closest to
+	the newest source time which all (non-stalled) members have reached.  The frames are buffered by reference, so
+	nothing is copied
+*/
+void UNDIMediaReceiveGroup::LatchMembers_RenderThread()
+{
+	// This function is called on the Engine's Main Rendering Thread. Be very careful when doing stuff here.
+	// Make sure things are done quick and efficient.
+
+	FScopeLock Lock(&GroupSyncContext);
+
+	const double Now = FPlatformTime::Seconds();
+
+	for (FMemberState& MemberState : MemberStates)
+	{
+		if (MemberState.Receiver == nullptr)
+			continue;
+
+		// Capturing through the receiver also delivers the frame to its subscriptions
+		const FNDIMediaVideoFramePtr CapturedFrame = MemberState.Receiver->CaptureVideoFrame();
+		if (!CapturedFrame.IsValid())
+			continue;
+
+		// Members are delayed before they are aligned, so that the delay of a member shifts it against the others
+		const FNDIMediaVideoFramePtr DelayedFrame = MemberState.Receiver->DelayVideoFrame(CapturedFrame.ToSharedRef());
+		if (!DelayedFrame.IsValid())
+			continue;
+
+		// The frame-sync repeats its last frame until a new one arrives
+		if ((MemberState.NumFrames > 0) && (MemberState.Frames[MemberState.NewestFrame].Frame == DelayedFrame))
+			continue;
+
+		const NDIlib_video_frame_v2_t& video_frame = DelayedFrame->GetFrame();
+
+		// Replace the oldest frame in the ring, which releases it unless something else still holds it
+		MemberState.NewestFrame = (MemberState.NewestFrame + 1) % MemberState.Frames.Num();
+		MemberState.NumFrames = FMath::Min(MemberState.NumFrames + 1, MemberState.Frames.Num());
+
+		FBufferedFrame& BufferedFrame = MemberState.Frames[MemberState.NewestFrame];
+		BufferedFrame.Time = (bAlignOnTimecode || (video_frame.timestamp == NDIlib_recv_timestamp_undefined)) ? video_frame.timecode : video_frame.timestamp;
+		BufferedFrame.Frame = DelayedFrame;
+
+		MemberState.LastArrivalTime = Now;
+	}
+
+	// Find the newest source time which every member has reached. Members which stopped receiving frames
+	// are left out, so that they don't hold back the others
+	int64 CommonTime = MAX_int64;
+	for (const FMemberState& MemberState : MemberStates)
+	{
+		if ((MemberState.NumFrames > 0) && ((Now - MemberState.LastArrivalTime) <= StallTimeout))
+			CommonTime = FMath::Min(CommonTime, MemberState.Frames[MemberState.NewestFrame].Time);
+	}
+
+	if (CommonTime == MAX_int64)
+		return;
+
+	// Present the frame closest to the common time for every member, all in this same engine frame
+	float GroupSkew = 0.f;
+	for (FMemberState& MemberState : MemberStates)
+	{
+		if (MemberState.NumFrames == 0)
+			continue;
+
+		int32 ClosestFrame = MemberState.NewestFrame;
+		for (int32 Age = 1; Age < MemberState.NumFrames; ++Age)
+		{
+			const int32 FrameIndex = (MemberState.NewestFrame - Age + MemberState.Frames.Num()) % MemberState.Frames.Num();
+			if (FMath::Abs(MemberState.Frames[FrameIndex].Time - CommonTime) < FMath::Abs(MemberState.Frames[ClosestFrame].Time - CommonTime))
+				ClosestFrame = FrameIndex;
+		}
+
+		const FBufferedFrame& BufferedFrame = MemberState.Frames[ClosestFrame];
+
+		// Times are in 100ns intervals
+		MemberState.Skew = (float)((BufferedFrame.Time - CommonTime) / 1e+4);
+		GroupSkew = FMath::Max(GroupSkew, FMath::Abs(MemberState.Skew));
+
+		MemberState.Receiver->PresentVideoFrame(BufferedFrame.Frame->GetFrame());
+	}
+
+	MaximumSkew = GroupSkew;
+}
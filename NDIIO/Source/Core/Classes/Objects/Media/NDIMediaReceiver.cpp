@@ -19,8 +19,16 @@
 #include <Misc/EngineVersionComparison.h>
 #include <UObject/UObjectGlobals.h>
 #include <UObject/Package.h>
+#include <Services/NDIFinderService.h>
+#include <Services/NDIEventDispatcher.h>
+#include <NDIIOPluginModule.h>
 
 #include "NDIShaders.h"
+#include "NDILateLatchViewExtension.h"
+#include "NDIMediaDelayLine.h"
+#include "NDIMediaReaper.h"
+#include "NDIMediaMetadataCapture.h"
+#include "NDIMediaVideoArrival.h"
 
 #if WITH_EDITOR
 #include <Editor.h>
@@ -28,9 +36,17 @@
 
 #include <string>
 
+/** The keys under which the Blueprint events of a receiver are coalesced */
+static constexpr uint32 ReceiverVideoReceivedEventKey = 1;
+static constexpr uint32 ReceiverAudioReceivedEventKey = 2;
+static constexpr uint32 ReceiverMetaDataReceivedEventKey = 3;
+
 UNDIMediaReceiver::UNDIMediaReceiver()
 {
-	this->InternalVideoTexture = NewObject<UNDIMediaTexture2D>(GetTransientPackage(), UNDIMediaTexture2D::StaticClass(), NAME_None, RF_Transient | RF_MarkAsNative);
+	// The internal video texture is only created once the receiver is used, so that default objects and receivers
+	// which only live in the content browser don't carry one around
+
+	this->DelayLine = MakeShared<FNDIMediaDelayLine, ESPMode::ThreadSafe>();
 }
 
 /**
@@ -38,22 +54,34 @@ UNDIMediaReceiver::UNDIMediaReceiver()
 */
 bool UNDIMediaReceiver::Initialize(const FNDIConnectionInformation& InConnectionInformation, UNDIMediaReceiver::EUsage InUsage)
 {
+	// The NDI runtime is loaded on first use of the plugin
+	FNDIIOPluginModule::EnsureNDIRuntime();
+
 	if (this->p_receive_instance == nullptr)
 	{
-		if (IsValid(this->InternalVideoTexture))
+		if (IsValid(GetOrCreateInternalVideoTexture()))
 			this->InternalVideoTexture->UpdateResource();
 
+		// Apply the delay which may have been set up before initializing
+		this->DelayLine->SetDelay(this->Delay / 1000.0, this->MaximumDelay / 1000.0, (int64)FMath::Max(this->MaximumDelayMemory, 0) * 1024 * 1024);
+
 		// create a non-connected receiver instance
 		NDIlib_recv_create_v3_t settings;
 		settings.allow_video_fields = false;
 		settings.bandwidth = NDIlib_recv_bandwidth_highest;
 		settings.color_format = NDIlib_recv_color_format_fastest;
 
-		p_receive_instance = NDIlib_recv_create_v3(&settings);
+		NDIlib_recv_instance_t receive_instance = NDIlib_recv_create_v3(&settings);
 
 		// check if it was successful
-		if (p_receive_instance != nullptr)
+		if (receive_instance != nullptr)
 		{
+			{
+				FScopeLock Lock(&InstanceSyncContext);
+				ReceiverInstance = MakeShared<FNDIMediaReceiverInstance, ESPMode::ThreadSafe>(receive_instance, nullptr);
+				p_receive_instance = receive_instance;
+			}
+
 			// If the incoming connection information is valid
 			if (InConnectionInformation.IsValid())
 			{
@@ -61,7 +89,7 @@ bool UNDIMediaReceiver::Initialize(const FNDIConnectionInformation& InConnection
 				ChangeConnection(InConnectionInformation);
 			}
 
-			if (InUsage == UNDIMediaReceiver::EUsage::Standalone)
+			if ((InUsage == UNDIMediaReceiver::EUsage::Standalone) || (InUsage == UNDIMediaReceiver::EUsage::Grouped))
 			{
 				this->OnNDIReceiverVideoCaptureEvent.Remove(VideoCaptureEventHandle);
 				VideoCaptureEventHandle = this->OnNDIReceiverVideoCaptureEvent.AddLambda([this](UNDIMediaReceiver* receiver, const NDIlib_video_frame_v2_t& video_frame)
@@ -69,30 +97,45 @@ bool UNDIMediaReceiver::Initialize(const FNDIConnectionInformation& InConnection
 					FTextureRHIRef ConversionTexture = this->DisplayFrame(video_frame);
 					if (ConversionTexture != nullptr)
 					{
-						if ((GetVideoTextureResource() != nullptr) && (GetVideoTextureResource()->TextureRHI != ConversionTexture))
-						{
-							GetVideoTextureResource()->TextureRHI = ConversionTexture;
-							RHIUpdateTextureReference(this->VideoTexture->TextureReference.TextureReferenceRHI, ConversionTexture);
-						}
-						if ((GetInternalVideoTextureResource() != nullptr) && (GetInternalVideoTextureResource()->TextureRHI != ConversionTexture))
-						{
-							GetInternalVideoTextureResource()->TextureRHI = ConversionTexture;
-							RHIUpdateTextureReference(this->InternalVideoTexture->TextureReference.TextureReferenceRHI, ConversionTexture);
-						}
+						this->UpdateVideoTextureReferences(ConversionTexture);
 					}
 				});
 
+				// Latch the video frame just before the views render, so that a frame which arrived during
+				// the current engine frame is displayed by it rather than by the next one.
+				// Grouped receivers have their frames presented by the receive group instead.
+				FNDILateLatchViewExtension::Release(LateLatchViewExtension);
+				if ((InUsage == UNDIMediaReceiver::EUsage::Standalone) && (GEngine != nullptr))
+				{
+					LateLatchViewExtension = FSceneViewExtensions::NewExtension<FNDILateLatchViewExtension>([this]()
+					{
+						this->CaptureConnectedVideo();
+					});
+				}
+
 				// We don't want to limit the engine rendering speed to the sync rate of the connection hook
 				// into the core delegates render thread 'EndFrame'
 				FCoreDelegates::OnEndFrameRT.Remove(FrameEndRTHandle);
 				FrameEndRTHandle.Reset();
-				FrameEndRTHandle = FCoreDelegates::OnEndFrameRT.AddLambda([this]()
+				FrameEndRTHandle = FCoreDelegates::OnEndFrameRT.AddLambda([this, InUsage, ViewExtension = LateLatchViewExtension]()
 				{
-					while(this->CaptureConnectedMetadata())
-						; // Potential improvement: limit how much metadata is processed, to avoid appearing to lock up due to a metadata flood
-					this->CaptureConnectedVideo();
+					// If no view was rendered this frame (e.g. the texture is only used by Slate), capture here instead
+					if (ViewExtension.IsValid())
+						ViewExtension->LatchIfPending_RenderThread();
+					else if (InUsage == UNDIMediaReceiver::EUsage::Standalone)
+						this->CaptureConnectedVideo();
+					else
+					{
+						// The receive group presents our frames, but we keep our own metrics up to date
+						FScopeLock Lock(&this->RenderSyncContext);
+						if (this->p_receive_instance != nullptr)
+							this->GatherPerformanceMetrics();
+					}
 				});
 
+				// Metadata is captured on a thread of its own, and delivered on the game thread
+				StartMetadataCapture();
+
 #if UE_EDITOR
 				// We don't want to provide perceived issues with the plugin not working so
 				// when we get a Pre-exit message, forcefully shutdown the receiver
@@ -124,10 +167,6 @@ bool UNDIMediaReceiver::Initialize(UNDIMediaReceiver::EUsage InUsage)
 
 void UNDIMediaReceiver::StartConnection()
 {
-	FScopeLock RenderLock(&RenderSyncContext);
-	FScopeLock AudioLock(&AudioSyncContext);
-	FScopeLock MetadataLock(&MetadataSyncContext);
-
 	if (this->ConnectionInformation.IsValid())
 	{
 		// Create a non-connected receiver instance
@@ -138,10 +177,28 @@ void UNDIMediaReceiver::StartConnection()
 
 		// Do the conversion on the connection information
 		// Beware of the limited lifetime of TCHAR_TO_UTF8 values
+		// Without a url, connect directly to where the source was found (in this or a previous session)
+		// rather than waiting for the receiver to discover it by name
+		const FString SourceName = this->ConnectionInformation.GetNDIName();
+		ConnectedUrl = this->ConnectionInformation.Url;
+		bIsConnectedFromSourceCache = false;
+		if (ConnectedUrl.IsEmpty() && !SourceName.IsEmpty())
+		{
+			FNDIConnectionInformation NetworkSource;
+			if (FNDIFinderService::FindNetworkSourceByName(SourceName, NetworkSource))
+				ConnectedUrl = NetworkSource.Url;
+			else if (FNDIFinderService::FindCachedSourceUrl(SourceName, ConnectedUrl))
+				bIsConnectedFromSourceCache = true;
+		}
+
+		// Reconnect once discovery has found the source, in case it moved since it was cached
+		if (bIsConnectedFromSourceCache && !SourceCollectionDeltaHandle.IsValid())
+			SourceCollectionDeltaHandle = FNDIFinderService::EventOnNDISourceCollectionDelta.AddUObject(this, &UNDIMediaReceiver::OnSourceCollectionDelta);
+
 		NDIlib_source_t connection;
-		std::string SourceNameStr(TCHAR_TO_UTF8(*this->ConnectionInformation.GetNDIName()));
+		std::string SourceNameStr(TCHAR_TO_UTF8(*SourceName));
 		connection.p_ndi_name = SourceNameStr.c_str();
-		std::string UrlStr(TCHAR_TO_UTF8(*this->ConnectionInformation.Url));
+		std::string UrlStr(TCHAR_TO_UTF8(*ConnectedUrl));
 		connection.p_url_address = UrlStr.c_str();
 
 		// Create a receiver and connect to the source
@@ -151,29 +208,81 @@ void UNDIMediaReceiver::StartConnection()
 		// Get rid of existing connection
 		StopConnection();
 
-		// set the receiver to the new connection
-		p_receive_instance = receive_instance;
-
 		// create a new frame sync instance
-		p_framesync_instance = NDIlib_framesync_create(p_receive_instance);
+		NDIlib_framesync_instance_t framesync_instance = NDIlib_framesync_create(receive_instance);
+
+		// Set the receiver to the new connection, which the capture paths pick up with their next capture.
+		// Frames captured from the new connection keep it alive until they are released
+		{
+			FScopeLock Lock(&InstanceSyncContext);
+			ReceiverInstance = MakeShared<FNDIMediaReceiverInstance, ESPMode::ThreadSafe>(receive_instance, framesync_instance);
+			p_receive_instance = receive_instance;
+			p_framesync_instance = framesync_instance;
+		}
+
+		if (MetadataCapture.IsValid())
+			MetadataCapture->SetInstance(ReceiverInstance);
+		if (VideoArrival.IsValid())
+			VideoArrival->SetInstance(ReceiverInstance);
+	}
+}
+
+/**
+	Validates a connection made from the source cache against the sources found by discovery
+*/
+void UNDIMediaReceiver::OnSourceCollectionDelta(const FNDISourceCollectionDelta& Delta)
+{
+	if (!bIsConnectedFromSourceCache)
+		return;
+
+	const FString SourceName = this->ConnectionInformation.GetNDIName();
+
+	for (const TArray<FNDIConnectionInformation>* Sources : { &Delta.Added, &Delta.Changed })
+	{
+		for (const FNDIConnectionInformation& Source : *Sources)
+		{
+			if (Source.SourceName.Equals(SourceName, ESearchCase::IgnoreCase))
+			{
+				bIsConnectedFromSourceCache = false;
+
+				// The source is still where it was, so the connection can stay
+				if ((Source.Url != ConnectedUrl) && (p_receive_instance != nullptr))
+					StartConnection();
+				return;
+			}
+		}
 	}
 }
 
 void UNDIMediaReceiver::StopConnection()
 {
-	FScopeLock RenderLock(&RenderSyncContext);
-	FScopeLock AudioLock(&AudioSyncContext);
-	FScopeLock MetadataLock(&MetadataSyncContext);
+	if (MetadataCapture.IsValid())
+		MetadataCapture->SetInstance(nullptr);
+	if (VideoArrival.IsValid())
+		VideoArrival->SetInstance(nullptr);
+
+	// Only the instances are swapped out here, so the game thread never waits on a capture in progress.  The
+	// capture paths and the captured frames hold on to the instance they use, and the reaper destroys it off
+	// the game thread once they have all released it
+	TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> RetiredInstance;
+	{
+		FScopeLock Lock(&InstanceSyncContext);
+		RetiredInstance = MoveTemp(ReceiverInstance);
+		p_framesync_instance = nullptr;
+		p_receive_instance = nullptr;
+	}
 
-	// destroy the framesync instance
-	if (p_framesync_instance != nullptr)
-		NDIlib_framesync_destroy(p_framesync_instance);
-	p_framesync_instance = nullptr;
+	FNDIMediaReaper::RetireReceiverInstance(MoveTemp(RetiredInstance));
+}
 
-	// Free the receiver
-	if (p_receive_instance != nullptr)
-		NDIlib_recv_destroy(p_receive_instance);
-	p_receive_instance = nullptr;
+/**
+	Returns the receiver and frame-sync instances of the current connection.  Holding on to them keeps them alive,
+	so the SDK can be called through them without holding the lock they are swapped under
+*/
+TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> UNDIMediaReceiver::GetReceiverInstance() const
+{
+	FScopeLock Lock(&InstanceSyncContext);
+	return ReceiverInstance;
 }
 
 /**
@@ -255,6 +364,33 @@ void UNDIMediaReceiver::ChangeVideoTexture(UNDIMediaTexture2D* InVideoTexture)
 	this->VideoTexture = InVideoTexture;
 }
 
+/**
+	Sets the delay (in milliseconds) applied to the video and audio of the source
+*/
+void UNDIMediaReceiver::SetDelay(float InDelay)
+{
+	this->Delay = FMath::Clamp(InDelay, 0.f, this->MaximumDelay);
+
+	// The delay line picks up the new delay with the next frame, without needing to reconnect
+	this->DelayLine->SetDelay(this->Delay / 1000.0, this->MaximumDelay / 1000.0, (int64)FMath::Max(this->MaximumDelayMemory, 0) * 1024 * 1024);
+}
+
+/**
+	Sets the delay applied to the video and audio of the source as a number of frames at the current frame rate
+*/
+void UNDIMediaReceiver::SetDelayFrames(int32 InFrames)
+{
+	SetDelay((float)(FMath::Max(InFrames, 0) * this->FrameRate.AsInterval() * 1000.0));
+}
+
+/**
+	Returns the delay (in milliseconds) applied to the video and audio of the source
+*/
+float UNDIMediaReceiver::GetDelay() const
+{
+	return this->Delay;
+}
+
 /**
 	Attempts to generate the pcm data required by the 'AudioWave' object
 	We will generate mono audio, down-mixing if the source has multiple channels
@@ -263,21 +399,39 @@ int32 UNDIMediaReceiver::GeneratePCMData(UNDIMediaSoundWave* AudioWave, uint8* P
 {
 	FScopeLock Lock(&AudioSyncContext);
 
+	// Hold on to the connection while capturing from it, it may be swapped out by the game thread meanwhile
+	const TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> Instance = GetReceiverInstance();
+	NDIlib_framesync_instance_t framesync_instance = Instance.IsValid() ? Instance->GetFramesyncInstance() : nullptr;
+
 	int32 samples_generated = 0;
 	int32 requested_frame_rate = IsValid(AudioWave) ? AudioWave->GetSampleRateForCurrentPlatform() : 48000;
 	int32 requested_no_channels = IsValid(AudioWave) ? AudioWave->NumChannels : 1;
 	int32 requested_no_frames = SamplesNeeded / requested_no_channels;
 
-	if ((p_framesync_instance != nullptr) && (ConnectionInformation.bMuteAudio == false))
+	if ((framesync_instance != nullptr) && (ConnectionInformation.bMuteAudio == false))
 	{
-		int available_no_frames = NDIlib_framesync_audio_queue_depth(p_framesync_instance);	// Samples per channel
+		int available_no_frames = NDIlib_framesync_audio_queue_depth(framesync_instance);	// Samples per channel
 
 		if (available_no_frames > 0)
 		{
+			NDIlib_audio_frame_v2_t captured_frame;
+			NDIlib_framesync_capture_audio(framesync_instance, &captured_frame, requested_frame_rate, 0, FMath::Min(available_no_frames, requested_no_frames));
+
+			// Take the samples from the delay line, which hands back the captured frame when there is no delay
 			NDIlib_audio_frame_v2_t audio_frame;
-			NDIlib_framesync_capture_audio(p_framesync_instance, &audio_frame, requested_frame_rate, 0, FMath::Min(available_no_frames, requested_no_frames));
+			const bool bHaveDelayedAudio = DelayLine->DelayAudio(FNDIMediaDelayLine::EAudioConsumer::SoundWaves, captured_frame, audio_frame);
+
+			if (!bHaveDelayedAudio)
+			{
+				// Output silence until the delay line has filled up
+				const int32 available_samples = FMath::Min(captured_frame.no_samples * requested_no_channels, SamplesNeeded);
+
+				FMemory::Memset(PCMData, 0, available_samples * sizeof(int16));
+
+				samples_generated = available_samples;
+			}
 
-			if (requested_no_channels == audio_frame.no_channels)
+			else if (requested_no_channels == audio_frame.no_channels)
 			{
 				// Convert to PCM
 				for (int32 channel_index = 0; channel_index < requested_no_channels; ++channel_index)
@@ -392,10 +546,11 @@ int32 UNDIMediaReceiver::GeneratePCMData(UNDIMediaSoundWave* AudioWave, uint8* P
 				}
 			}
 
-			samples_generated = audio_frame.no_samples * requested_no_channels;
+			if (bHaveDelayedAudio)
+				samples_generated = audio_frame.no_samples * requested_no_channels;
 
 			// clean up our audio frame
-			NDIlib_framesync_free_audio(p_framesync_instance, &audio_frame);
+			NDIlib_framesync_free_audio(framesync_instance, &captured_frame);
 		}
 		else
 		{
@@ -414,16 +569,19 @@ int32 UNDIMediaReceiver::GetAudioChannels()
 {
 	FScopeLock Lock(&AudioSyncContext);
 
+	const TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> Instance = GetReceiverInstance();
+	NDIlib_framesync_instance_t framesync_instance = Instance.IsValid() ? Instance->GetFramesyncInstance() : nullptr;
+
 	int32 no_channels = 0;
 
-	if ((p_framesync_instance != nullptr) && (ConnectionInformation.bMuteAudio == false))
+	if ((framesync_instance != nullptr) && (ConnectionInformation.bMuteAudio == false))
 	{
-		int available_no_frames = NDIlib_framesync_audio_queue_depth(p_framesync_instance);	// Samples per channel
+		int available_no_frames = NDIlib_framesync_audio_queue_depth(framesync_instance);	// Samples per channel
 
 		if (available_no_frames > 0)
 		{
 			NDIlib_audio_frame_v2_t audio_frame;
-			NDIlib_framesync_capture_audio(p_framesync_instance, &audio_frame, 48000, 0, 0);
+			NDIlib_framesync_capture_audio(framesync_instance, &audio_frame, 48000, 0, 0);
 			no_channels = audio_frame.no_channels;
 		}
 	}
@@ -462,10 +620,11 @@ void UNDIMediaReceiver::SendMetadataFrame(const FString& Data)
 
 	if (p_receive_instance != nullptr)
 	{
+		FTCHARToUTF8 DataStr(*Data);
+
 		NDIlib_metadata_frame_t metadata;
-		std::string DataStr(TCHAR_TO_UTF8(*Data));
-		metadata.p_data = const_cast<char*>(DataStr.c_str());
-		metadata.length = DataStr.length();
+		metadata.p_data = const_cast<char*>(DataStr.Get());
+		metadata.length = DataStr.Length();
 		metadata.timecode = FDateTime::Now().GetTimeOfDay().GetTicks();
 
 		NDIlib_recv_send_metadata(p_receive_instance, &metadata);
@@ -474,12 +633,14 @@ void UNDIMediaReceiver::SendMetadataFrame(const FString& Data)
 
 /**
 	This will send a metadata frame to the sender
-	The data will be formatted as: <Element AttributeData/>
+	The data will be formatted as: <Element>ElementData</Element>
 */
 void UNDIMediaReceiver::SendMetadataFrameAttr(const FString& Element, const FString& ElementData)
 {
-	FString Data = "<" + Element + ">" + ElementData + "</" + Element + ">";
-	SendMetadataFrame(Data);
+	FNDIMetadataWriter Metadata;
+	Metadata.OpenElement(Element).Raw(ElementData).CloseElement();
+
+	SendMetadataFrameUtf8(Metadata);
 }
 
 /**
@@ -488,16 +649,36 @@ void UNDIMediaReceiver::SendMetadataFrameAttr(const FString& Element, const FStr
 */
 void UNDIMediaReceiver::SendMetadataFrameAttrs(const FString& Element, const TMap<FString,FString>& Attributes)
 {
-	FString Data = "<" + Element;
-	
+	FNDIMetadataWriter Metadata;
+	Metadata.OpenElement(Element);
+
 	for(const auto& Attribute : Attributes)
 	{
-		Data += " " + Attribute.Key + "=\"" + Attribute.Value + "\"";
+		FTCHARToUTF8 Key(*Attribute.Key);
+		Metadata.Attribute(FAnsiStringView(Key.Get(), Key.Length()), Attribute.Value);
 	}
 
-	Data += "/>";
+	Metadata.CloseElement();
+
+	SendMetadataFrameUtf8(Metadata);
+}
+
+/**
+	This will send the metadata built by the writer to the sender, without converting it
+*/
+void UNDIMediaReceiver::SendMetadataFrameUtf8(const FNDIMetadataWriter& Metadata)
+{
+	FScopeLock Lock(&MetadataSyncContext);
+
+	if ((p_receive_instance != nullptr) && !Metadata.IsEmpty())
+	{
+		NDIlib_metadata_frame_t metadata;
+		metadata.p_data = const_cast<char*>(Metadata.GetData());
+		metadata.length = Metadata.Len();
+		metadata.timecode = FDateTime::Now().GetTimeOfDay().GetTicks();
 
-	SendMetadataFrame(Data);
+		NDIlib_recv_send_metadata(p_receive_instance, &metadata);
+	}
 }
 
 
@@ -517,17 +698,63 @@ void UNDIMediaReceiver::Shutdown()
 {
 	ENQUEUE_RENDER_COMMAND(NDIMediaReceiver_ShutdownRT)([this](FRHICommandListImmediate& RHICmdList)
 	{
+		FScopeLock Lock(&this->RenderSyncContext);
+
 		this->RenderTarget.SafeRelease();
 		this->RenderTargetDescriptor = FPooledRenderTargetDesc();
+		this->LastConvertedFrameKey = FConvertedFrameKey();
+
+		this->SourceTexture.SafeRelease();
+		this->SourceAlphaTexture.SafeRelease();
+		this->DrawMode = EDrawMode::Invalid;
+		this->ConversionCache.Empty();
+		this->ConversionCacheStats.Entries = 0;
+		this->ConversionCacheStats.Bytes = 0;
+
+		// Release the captured and delayed frames, which lets the reaper destroy the instance they came from
+		this->LastCapturedVideoFrame.Reset();
+		this->DelayLine->ResetVideo();
+
+		// Start the performance metrics over with the next connection
+		this->PerformanceWindow = FPerformanceWindow();
+		this->LastPerformanceSampleTime = 0.0;
+		this->DecodedVideoBytes = 0;
+		this->LastPresentedTicks = 0;
+		this->LastPresentedTimestamp = 0;
 	});
 
 	this->OnNDIReceiverVideoCaptureEvent.Remove(VideoCaptureEventHandle);
 	VideoCaptureEventHandle.Reset();
 
+	FNDIFinderService::EventOnNDISourceCollectionDelta.Remove(SourceCollectionDeltaHandle);
+	SourceCollectionDeltaHandle.Reset();
+	bIsConnectedFromSourceCache = false;
+
 	// Unregister render thread frame end delegate lambda.
 	FCoreDelegates::OnEndFrameRT.Remove(FrameEndRTHandle);
 	FrameEndRTHandle.Reset();
 
+	// Stop latching video frames before the views render
+	FNDILateLatchViewExtension::Release(LateLatchViewExtension);
+
+	StopMetadataCapture();
+
+	// Nobody waits on the arrival of frames anymore, so let the reaper join its thread
+	TSharedPtr<FNDIMediaVideoArrival, ESPMode::ThreadSafe> Arrival;
+	{
+		FScopeLock SubscriptionLock(&SubscriptionSyncContext);
+		Arrival = MoveTemp(VideoArrival);
+	}
+
+	if (Arrival.IsValid())
+	{
+		Arrival->SetInstance(nullptr);
+		FNDIMediaReaper::Retire([RetiredArrival = MoveTemp(Arrival)]() mutable
+		{
+			RetiredArrival.Reset();
+		});
+	}
+
 	// Move audio source collection to temporary, so that cleanup can be done without
 	// holding the lock (which could otherwise cause a deadlock if UNDIMediaSoundWave
 	// is still generating PCM data)
@@ -556,29 +783,19 @@ void UNDIMediaReceiver::Shutdown()
 		}
 	}
 
-	{
-		FScopeLock RenderLock(&RenderSyncContext);
-		FScopeLock AudioLock(&AudioSyncContext);
-		FScopeLock MetadataLock(&MetadataSyncContext);
-
-		if (p_receive_instance != nullptr)
-		{
-			if (p_framesync_instance != nullptr)
-			{
-				NDIlib_framesync_destroy(p_framesync_instance);
-				p_framesync_instance = nullptr;
-			}
-
-			NDIlib_recv_destroy(p_receive_instance);
-			p_receive_instance = nullptr;
-		}
-	}
+	// Hand the framesync and receiver instances to the reaper.  The video side lets go of its frames on the
+	// render thread above, and the audio consumers drop their samples with their next capture
+	StopConnection();
+	DelayLine->ResetAudio();
 
 	// Reset the connection status of this object
 	SetIsCurrentlyConnected(false);
 
 	this->ConnectionInformation.Reset();
-	this->PerformanceData.Reset();
+	{
+		FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+		this->PerformanceData.Reset();
+	}
 	this->FrameRate = FFrameRate(60, 1);
 	this->Resolution = FIntPoint(0, 0);
 	this->Timecode = FTimecode(0, FrameRate, true, true);
@@ -615,7 +832,7 @@ void UNDIMediaReceiver::UpdateMaterialTexture(UMaterialInstanceDynamic* Material
 			// Call the function to set the texture parameter with the proper texture
 			MaterialInstance->SetTextureParameterValue(FName(*ParameterName), this->VideoTexture);
 		 }
-		 else if (IsValid(this->InternalVideoTexture))
+		 else if (IsValid(GetOrCreateInternalVideoTexture()))
 		 {
 			// Call the function to set the texture parameter with the proper texture
 			MaterialInstance->SetTextureParameterValue(FName(*ParameterName), this->InternalVideoTexture);
@@ -650,177 +867,647 @@ bool UNDIMediaReceiver::CaptureConnectedVideo()
 
 	bool bHaveCaptured = false;
 
+	// Using a frame-sync we can always get data which is the magic and it will adapt
+	// to the frame-rate that it is being called with.
+	FNDIMediaVideoFramePtr captured_frame = CaptureVideoFrame();
+
 	// check for our frame sync object and that we are actually connected to the end point
 	if ((p_framesync_instance != nullptr) && (ConnectionInformation.bMuteVideo == false))
 	{
-		// Using a frame-sync we can always get data which is the magic and it will adapt
-		// to the frame-rate that it is being called with.
-		NDIlib_video_frame_v2_t video_frame;
-		NDIlib_framesync_capture_video(p_framesync_instance, &video_frame, NDIlib_frame_format_type_progressive);
-
 		// Update our Performance Metrics
 		GatherPerformanceMetrics();
 
-		if (video_frame.p_data)
+		if (captured_frame.IsValid())
 		{
-			// Ensure that we inform all those interested when the stream starts up
-			SetIsCurrentlyConnected(true);
+			// Present the frame from the delay line, which hands back the captured frame when there is no delay
+			const FNDIMediaVideoFramePtr delayed_frame = DelayLine->DelayVideo(captured_frame.ToSharedRef(), FPlatformTime::Seconds());
+			if (delayed_frame.IsValid())
+				bHaveCaptured = PresentVideoFrame(delayed_frame->GetFrame());
+		}
+	}
 
-			// Update the Framerate, if it has changed
-			this->FrameRate.Numerator = video_frame.frame_rate_N;
-			this->FrameRate.Denominator = video_frame.frame_rate_D;
+	return bHaveCaptured;
+}
 
-			// Update the Resolution
-			this->Resolution.X = video_frame.xres;
-			this->Resolution.Y = video_frame.yres;
+/**
+	Captures the newest video frame held by the frame-sync as a frame which can be held on to.  The frame-sync
+	repeats its last frame until a new one arrives, the frame captured before is handed out again then.  A new
+	frame is delivered to the video frame subscriptions and signalled to those waiting on arrivals as it is captured,
+	whether the receiver is standalone or grouped.  Returns nullptr if there is no frame.
+*/
+FNDIMediaVideoFramePtr UNDIMediaReceiver::CaptureVideoFrame()
+{
+	// Ensure thread safety
+	FScopeLock Lock(&RenderSyncContext);
 
-			if (bSyncTimecodeToSource)
-			{
-				int64_t SourceTime = video_frame.timecode % 864000000000; // Modulo the number of 100ns intervals in 24 hours
-				// Update the timecode from the current 'SourceTime' value
-				this->Timecode = FTimecode::FromTimespan(FTimespan::FromSeconds(SourceTime / (float)1e+7), FrameRate,
-															FTimecode::IsDropFormatTimecodeSupported(FrameRate),
-															true // use roll-over timecode
-				);
-			}
-			else
-			{
-				int64_t SystemTime = FDateTime::Now().GetTimeOfDay().GetTicks();
-				// Update the timecode from the current 'SystemTime' value
-				this->Timecode = FTimecode::FromTimespan(FTimespan::FromSeconds(SystemTime / (float)1e+7), FrameRate,
-															FTimecode::IsDropFormatTimecodeSupported(FrameRate),
-															true // use roll-over timecode
-				);
-			}
+	// The captured frame keeps the instance it came from alive, after the game thread has moved on from it
+	const TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> Instance = GetReceiverInstance();
+	NDIlib_framesync_instance_t framesync_instance = Instance.IsValid() ? Instance->GetFramesyncInstance() : nullptr;
 
-			// Redraw if:
-			// - timestamp is undefined, or
-			// - timestamp has changed, or
-			// - frame format type has changed (e.g. different field)
-			if ((video_frame.timestamp == NDIlib_recv_timestamp_undefined) ||
-				(video_frame.timestamp != LastFrameTimestamp) ||
-				(video_frame.frame_format_type != LastFrameFormatType))
-			{
-				bHaveCaptured = true;
+	if ((framesync_instance == nullptr) || (ConnectionInformation.bMuteVideo == true))
+	{
+		// Don't keep a disconnected instance alive
+		LastCapturedVideoFrame.Reset();
+		return nullptr;
+	}
 
-				LastFrameTimestamp = video_frame.timestamp;
-				LastFrameFormatType = video_frame.frame_format_type;
+	NDIlib_video_frame_v2_t video_frame;
+	NDIlib_framesync_capture_video(framesync_instance, &video_frame, NDIlib_frame_format_type_progressive);
 
-				OnNDIReceiverVideoCaptureEvent.Broadcast(this, video_frame);
+	if (video_frame.p_data == nullptr)
+	{
+		NDIlib_framesync_free_video(framesync_instance, &video_frame);
+		return nullptr;
+	}
 
-				OnReceiverVideoReceived.Broadcast(this);
+	if (LastCapturedVideoFrame.IsValid() && (video_frame.timestamp != NDIlib_recv_timestamp_undefined) &&
+		(video_frame.timestamp == LastCapturedVideoFrame->GetTimestamp()))
+	{
+		NDIlib_framesync_free_video(framesync_instance, &video_frame);
+		return LastCapturedVideoFrame;
+	}
 
-				if (video_frame.p_metadata)
-				{
-					FString Data(UTF8_TO_TCHAR(video_frame.p_metadata));
-					OnReceiverMetaDataReceived.Broadcast(this, Data, true);
-				}
-			}
+	// The shared frame releases the video once the last one holding it is done with it
+	LastCapturedVideoFrame = MakeShared<const FNDIMediaVideoFrame, ESPMode::ThreadSafe>(Instance.ToSharedRef(), video_frame);
+
+	{
+		FScopeLock SubscriptionLock(&SubscriptionSyncContext);
+
+		VideoFrameSubscriptions.RemoveAll([](const TWeakPtr<FNDIMediaVideoFrameSubscription, ESPMode::ThreadSafe>& Subscription) { return !Subscription.IsValid(); });
+
+		for (const TWeakPtr<FNDIMediaVideoFrameSubscription, ESPMode::ThreadSafe>& WeakSubscription : VideoFrameSubscriptions)
+		{
+			if (TSharedPtr<FNDIMediaVideoFrameSubscription, ESPMode::ThreadSafe> Subscription = WeakSubscription.Pin())
+				Subscription->Enqueue(LastCapturedVideoFrame.ToSharedRef());
 		}
 
-		// Release the video. You could keep the frame if you want and release it later.
-		NDIlib_framesync_free_video(p_framesync_instance, &video_frame);
+		if (VideoArrival.IsValid())
+			VideoArrival->NotifyArrival(video_frame);
 	}
 
-	return bHaveCaptured;
+	return LastCapturedVideoFrame;
 }
 
 
 /**
-	Attempts to capture an audio frame from the connected source.  If a new frame is captured, broadcast it to
-	interested receivers through the capture event.
+	Passes a captured video frame through the delay line of this receiver, and returns the frame to present now.
+	Returns the frame itself if there is no delay, or nullptr if no frame is old enough yet.
 */
-bool UNDIMediaReceiver::CaptureConnectedAudio()
+FNDIMediaVideoFramePtr UNDIMediaReceiver::DelayVideoFrame(const FNDIMediaVideoFrameRef& InFrame)
 {
-	FScopeLock Lock(&AudioSyncContext);
+	return DelayLine->DelayVideo(InFrame, FPlatformTime::Seconds());
+}
+
+/**
+	Subscribes to the video frames captured by this receiver, standalone or grouped.  The frames are delivered as
+	they are received, before any delay is applied, and can be consumed on any thread.  The subscription ends when the returned
+	object is released or passed to 'UnsubscribeVideoFrames'.
+*/
+FNDIMediaVideoFrameSubscriptionRef UNDIMediaReceiver::SubscribeVideoFrames(FNDIMediaVideoFrameSubscription::EMode InMode, int32 InCapacity)
+{
+	FNDIMediaVideoFrameSubscriptionRef Subscription = MakeShared<FNDIMediaVideoFrameSubscription, ESPMode::ThreadSafe>(InMode, InCapacity);
+
+	FScopeLock Lock(&SubscriptionSyncContext);
+	VideoFrameSubscriptions.Add(Subscription);
+
+	return Subscription;
+}
+
+/**
+	Stops delivering video frames to a subscription
+*/
+void UNDIMediaReceiver::UnsubscribeVideoFrames(const FNDIMediaVideoFrameSubscriptionRef& InSubscription)
+{
+	FScopeLock Lock(&SubscriptionSyncContext);
+	VideoFrameSubscriptions.RemoveAll([&InSubscription](const TWeakPtr<FNDIMediaVideoFrameSubscription, ESPMode::ThreadSafe>& Subscription) { return Subscription == InSubscription; });
+}
+
+
+/**
+	Updates the frame information from a captured video frame and, if it differs from the last one presented,
+	broadcasts it to interested receivers through the capture event.  Returns true if the frame was new.
+*/
+bool UNDIMediaReceiver::PresentVideoFrame(const NDIlib_video_frame_v2_t& video_frame)
+{
+	// Ensure thread safety
+	FScopeLock Lock(&RenderSyncContext);
 
 	bool bHaveCaptured = false;
 
-	if ((p_framesync_instance != nullptr) && (ConnectionInformation.bMuteAudio == false))
+	// Ensure that we inform all those interested when the stream starts up
+	SetIsCurrentlyConnected(true);
+
+	// Update the Framerate, if it has changed
+	this->FrameRate.Numerator = video_frame.frame_rate_N;
+	this->FrameRate.Denominator = video_frame.frame_rate_D;
+
+	// Update the Resolution
+	this->Resolution.X = video_frame.xres;
+	this->Resolution.Y = video_frame.yres;
+
+	// Update the timecode from the source or the system time of day, rolled over at 24 hours
+	TimecodeConverter.SetFrameRate(FrameRate);
+	if (bSyncTimecodeToSource)
+	{
+		this->Timecode = TimecodeConverter.FromTicks(video_frame.timecode);
+	}
+	else
 	{
-		int no_samples = NDIlib_framesync_audio_queue_depth(p_framesync_instance);
+		this->Timecode = TimecodeConverter.FromTicks(FDateTime::Now().GetTimeOfDay().GetTicks());
+	}
 
-		// Using a frame-sync we can always get data which is the magic and it will adapt
-		// to the frame-rate that it is being called with.
-		NDIlib_audio_frame_v2_t audio_frame;
-		NDIlib_framesync_capture_audio(p_framesync_instance, &audio_frame, 0, 0, no_samples);
+	// Redraw if:
+	// - timestamp is undefined, or
+	// - timestamp has changed, or
+	// - frame format type has changed (e.g. different field)
+	if ((video_frame.timestamp == NDIlib_recv_timestamp_undefined) ||
+		(video_frame.timestamp != LastFrameTimestamp) ||
+		(video_frame.frame_format_type != LastFrameFormatType))
+	{
+		bHaveCaptured = true;
 
-		if (audio_frame.p_data)
-		{
-			// Ensure that we inform all those interested when the stream starts up
-			SetIsCurrentlyConnected(true);
+		LastFrameTimestamp = video_frame.timestamp;
+		LastFrameFormatType = video_frame.frame_format_type;
 
-			const int32 available_samples = audio_frame.no_samples * audio_frame.no_channels;
+		// Measure the latency and jitter of the frames against their source timestamps
+		DecodedVideoBytes += int64(video_frame.line_stride_in_bytes) * video_frame.yres;
+		if (video_frame.timestamp != NDIlib_recv_timestamp_undefined)
+		{
+			// NDI timestamps are UTC, in 100 ns ticks since the Unix epoch
+			const int64 PresentedTicks = (FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTicks();
 
-			if (available_samples > 0)
+			// The delay asked for is not part of the latency
+			const int64 DelayTicks = FTimespan::FromSeconds(DelayLine->GetDelay()).GetTicks();
+			PerformanceWindow.Latency.Add(FMath::Max<int64>(PresentedTicks - video_frame.timestamp - DelayTicks, 0) / 10.0);
+			if (LastPresentedTicks > 0)
 			{
-				bHaveCaptured = true;
+				const int64 TransitVariation = (PresentedTicks - LastPresentedTicks) - (video_frame.timestamp - LastPresentedTimestamp);
+				PerformanceWindow.ArrivalJitter.Add(FMath::Abs(TransitVariation) / 10.0);
+			}
 
-				OnNDIReceiverAudioCaptureEvent.Broadcast(this, audio_frame);
+			LastPresentedTicks = PresentedTicks;
+			LastPresentedTimestamp = video_frame.timestamp;
+		}
 
-				OnReceiverAudioReceived.Broadcast(this);
-			}
+		OnNDIReceiverVideoCaptureEvent.Broadcast(this, video_frame);
+
+		// Blueprint events are delivered on the game thread, with the next batch
+		if (OnReceiverVideoReceived.IsBound())
+		{
+			FNDIEventDispatcher::EnqueueCoalesced(this, bCoalesceVideoReceivedEvents ? ReceiverVideoReceivedEventKey : 0, [this]()
+			{
+				OnReceiverVideoReceived.Broadcast(this);
+			});
 		}
 
-		// Release the audio frame
-		NDIlib_framesync_free_audio(p_framesync_instance, &audio_frame);
+		if (video_frame.p_metadata && OnReceiverMetaDataReceived.IsBound())
+		{
+			FNDIEventDispatcher::EnqueueCoalesced(this, bLatestMetaDataOnly ? ReceiverMetaDataReceivedEventKey : 0, [this, Data = FString(UTF8_TO_TCHAR(video_frame.p_metadata))]()
+			{
+				OnReceiverMetaDataReceived.Broadcast(this, Data, true);
+			});
+		}
+
+		if (video_frame.p_metadata && bHasBinaryMetadataSubscriptions)
+			EnqueueAttachedBinaryMetadata(video_frame.p_metadata, video_frame.timecode);
 	}
 
 	return bHaveCaptured;
 }
 
-
-bool UNDIMediaReceiver::CaptureConnectedMetadata()
+/**
+	Hands the newest video frame held by the frame-sync to 'Visitor' without displaying or broadcasting it.
+	Returns true if a frame was available.  The frame is only valid for the duration of the call.
+*/
+bool UNDIMediaReceiver::VisitConnectedVideo(TFunctionRef<void(const NDIlib_video_frame_v2_t&)> Visitor)
 {
-	FScopeLock Lock(&MetadataSyncContext);
-
-	bool bHaveCaptured = false;
+	// Ensure thread safety
+	FScopeLock Lock(&RenderSyncContext);
 
-	if (p_receive_instance != nullptr)
-	{
-		NDIlib_metadata_frame_t metadata;
-		NDIlib_frame_type_e frame_type = NDIlib_recv_capture_v3(p_receive_instance, nullptr, nullptr, &metadata, 0);
-		if (frame_type == NDIlib_frame_type_metadata)
-		{
-			if (metadata.p_data)
-			{
-				// Ensure that we inform all those interested when the stream starts up
-				SetIsCurrentlyConnected(true);
+	const TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> Instance = GetReceiverInstance();
+	NDIlib_framesync_instance_t framesync_instance = Instance.IsValid() ? Instance->GetFramesyncInstance() : nullptr;
 
-				if (metadata.length > 0)
-				{
-					bHaveCaptured = true;
+	bool bHaveFrame = false;
 
-					OnNDIReceiverMetadataCaptureEvent.Broadcast(this, metadata);
+	if ((framesync_instance != nullptr) && (ConnectionInformation.bMuteVideo == false))
+	{
+		// The frame-sync always hands out the most recent frame, so this does not consume anything
+		// that a later call to 'CaptureConnectedVideo' would otherwise have displayed
+		NDIlib_video_frame_v2_t video_frame;
+		NDIlib_framesync_capture_video(framesync_instance, &video_frame, NDIlib_frame_format_type_progressive);
 
-					FString Data(UTF8_TO_TCHAR(metadata.p_data));
-					OnReceiverMetaDataReceived.Broadcast(this, Data, false);
-				}
-			}
+		if (video_frame.p_data)
+		{
+			bHaveFrame = true;
 
-			NDIlib_recv_free_metadata(p_receive_instance, &metadata);
+			Visitor(video_frame);
 		}
+
+		NDIlib_framesync_free_video(framesync_instance, &video_frame);
 	}
 
-	return bHaveCaptured;
+	return bHaveFrame;
 }
 
-
-void UNDIMediaReceiver::SetIsCurrentlyConnected(bool bConnected)
+/**
+	Looks at the newest video frame held by the frame-sync without converting or broadcasting it.
+	Returns true if a frame is available, along with its timestamp and frame rate.
+*/
+bool UNDIMediaReceiver::PeekConnectedVideo(int64& OutTimestamp, FFrameRate& OutFrameRate)
 {
-	if (bConnected != bIsCurrentlyConnected)
+	return VisitConnectedVideo([&](const NDIlib_video_frame_v2_t& video_frame)
 	{
-		FScopeLock Lock(&ConnectionSyncContext);
+		// Fall back to the sender's timecode if the frame was not timestamped
+		OutTimestamp = (video_frame.timestamp != NDIlib_recv_timestamp_undefined) ? video_frame.timestamp : video_frame.timecode;
+		OutFrameRate = FFrameRate(video_frame.frame_rate_N, video_frame.frame_rate_D);
+	});
+}
 
-		if (bConnected != bIsCurrentlyConnected)
-		{
-			bIsCurrentlyConnected = bConnected;
+/**
+	Blocks until a video frame other than the one with 'InLastTimestamp' has arrived from the connected source, or
+	for at most 'InTimeout' seconds.  Frames are signalled as the receiver captures them, and as a short-interval poll
+	of the frame-sync on another thread sees them.
+*/
+bool UNDIMediaReceiver::WaitForConnectedVideo(int64 InLastTimestamp, double InTimeout, int64& OutTimestamp, FFrameRate& OutFrameRate)
+{
+	check(IsInGameThread());
 
-			if (bConnected == true)
+	// Only start watching once someone waits, like the connection this is only changed on the game thread
+	TSharedPtr<FNDIMediaVideoArrival, ESPMode::ThreadSafe> Arrival = VideoArrival;
+	if (!Arrival.IsValid())
+	{
+		Arrival = MakeShared<FNDIMediaVideoArrival, ESPMode::ThreadSafe>();
+		Arrival->SetInstance(ReceiverInstance);
+
+		// The capture path signals the frames it captures, under the same lock
+		FScopeLock SubscriptionLock(&SubscriptionSyncContext);
+		VideoArrival = Arrival;
+	}
+
+	return Arrival->Wait(InLastTimestamp, InTimeout, OutTimestamp, OutFrameRate);
+}
+
+/**
+	Points both the user supplied and the internal video texture at the converted frame
+*/
+void UNDIMediaReceiver::UpdateVideoTextureReferences(const FTextureRHIRef& ConversionTexture)
+{
+	// Swap both references together, so that no view rendered after this point can see a mix of frames
+	FScopeLock Lock(&RenderSyncContext);
+
+	if ((GetVideoTextureResource() != nullptr) && (GetVideoTextureResource()->TextureRHI != ConversionTexture))
+	{
+		GetVideoTextureResource()->TextureRHI = ConversionTexture;
+		RHIUpdateTextureReference(this->VideoTexture->TextureReference.TextureReferenceRHI, ConversionTexture);
+	}
+	if ((GetInternalVideoTextureResource() != nullptr) && (GetInternalVideoTextureResource()->TextureRHI != ConversionTexture))
+	{
+		GetInternalVideoTextureResource()->TextureRHI = ConversionTexture;
+		RHIUpdateTextureReference(this->InternalVideoTexture->TextureReference.TextureReferenceRHI, ConversionTexture);
+	}
+}
+
+
+/**
+	Attempts to capture an audio frame from the connected source.  If a new frame is captured, broadcast it to
+	interested receivers through the capture event.
+*/
+bool UNDIMediaReceiver::CaptureConnectedAudio()
+{
+	FScopeLock Lock(&AudioSyncContext);
+
+	const TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> Instance = GetReceiverInstance();
+	NDIlib_framesync_instance_t framesync_instance = Instance.IsValid() ? Instance->GetFramesyncInstance() : nullptr;
+
+	bool bHaveCaptured = false;
+
+	if ((framesync_instance != nullptr) && (ConnectionInformation.bMuteAudio == false))
+	{
+		int no_samples = NDIlib_framesync_audio_queue_depth(framesync_instance);
+
+		// Using a frame-sync we can always get data which is the magic and it will adapt
+		// to the frame-rate that it is being called with.
+		NDIlib_audio_frame_v2_t captured_frame;
+		NDIlib_framesync_capture_audio(framesync_instance, &captured_frame, 0, 0, no_samples);
+
+		// Take the samples from the delay line, which hands back the captured frame when there is no delay
+		NDIlib_audio_frame_v2_t audio_frame;
+
+		if (captured_frame.p_data)
+		{
+			// Ensure that we inform all those interested when the stream starts up
+			SetIsCurrentlyConnected(true);
+
+			const int32 available_samples = DelayLine->DelayAudio(FNDIMediaDelayLine::EAudioConsumer::CaptureEvents, captured_frame, audio_frame) ? audio_frame.no_samples * audio_frame.no_channels : 0;
+
+			if (available_samples > 0)
+			{
+				bHaveCaptured = true;
+
+				OnNDIReceiverAudioCaptureEvent.Broadcast(this, audio_frame);
+
+				if (OnReceiverAudioReceived.IsBound())
+				{
+					FNDIEventDispatcher::EnqueueCoalesced(this, bCoalesceAudioReceivedEvents ? ReceiverAudioReceivedEventKey : 0, [this]()
+					{
+						OnReceiverAudioReceived.Broadcast(this);
+					});
+				}
+			}
+		}
+
+		// Release the audio frame
+		NDIlib_framesync_free_audio(framesync_instance, &captured_frame);
+	}
+
+	return bHaveCaptured;
+}
+
+
+FString FNDIMetadataElement::ToString() const
+{
+	FUTF8ToTCHAR Converted(Data, Length);
+	return FString(Converted.Length(), Converted.Get());
+}
+
+void UNDIMediaReceiver::SubscribeToMetaDataElement(FName ElementName)
+{
+	BlueprintMetadataSubscriptions.Add(ElementName);
+
+	if (MetadataCapture.IsValid())
+		MetadataCapture->Subscribe(ElementName);
+}
+
+void UNDIMediaReceiver::UnsubscribeFromMetaDataElement(FName ElementName)
+{
+	BlueprintMetadataSubscriptions.Remove(ElementName);
+
+	if (MetadataCapture.IsValid() && !IsMetadataElementSubscribed(ElementName))
+		MetadataCapture->Unsubscribe(ElementName);
+}
+
+FDelegateHandle UNDIMediaReceiver::SubscribeToMetadataElement(FName ElementName, FNDIMetadataElementReceived::FDelegate&& Delegate)
+{
+	FDelegateHandle Handle = MetadataSubscriptions.FindOrAdd(ElementName).Add(MoveTemp(Delegate));
+
+	if (MetadataCapture.IsValid())
+		MetadataCapture->Subscribe(ElementName);
+
+	return Handle;
+}
+
+void UNDIMediaReceiver::UnsubscribeFromMetadataElement(FName ElementName, FDelegateHandle Handle)
+{
+	if (FNDIMetadataElementReceived* Subscription = MetadataSubscriptions.Find(ElementName))
+	{
+		Subscription->Remove(Handle);
+		if (!Subscription->IsBound())
+			MetadataSubscriptions.Remove(ElementName);
+	}
+
+	if (MetadataCapture.IsValid() && !IsMetadataElementSubscribed(ElementName))
+		MetadataCapture->Unsubscribe(ElementName);
+}
+
+FDelegateHandle UNDIMediaReceiver::SubscribeToBinaryMetadata(FName Channel, FNDIBinaryMetadataReceived::FDelegate&& Delegate)
+{
+	// All the channels arrive through the one element
+	if (!BinaryMetadataElementHandle.IsValid())
+	{
+		BinaryMetadataElementHandle = SubscribeToMetadataElement(FName(NDIIO_BINARY_METADATA_ELEMENT),
+			FNDIMetadataElementReceived::FDelegate::CreateUObject(this, &UNDIMediaReceiver::DeliverBinaryMetadata));
+	}
+
+	TSharedRef<FBinaryMetadataChannel>* BinaryChannel = BinaryMetadataChannels.Find(Channel);
+	if (BinaryChannel == nullptr)
+		BinaryChannel = &BinaryMetadataChannels.Add(Channel, MakeShared<FBinaryMetadataChannel>());
+
+	bHasBinaryMetadataSubscriptions = true;
+
+	return (*BinaryChannel)->Subscribers.Add(MoveTemp(Delegate));
+}
+
+void UNDIMediaReceiver::UnsubscribeFromBinaryMetadata(FName Channel, FDelegateHandle Handle)
+{
+	if (TSharedRef<FBinaryMetadataChannel>* BinaryChannel = BinaryMetadataChannels.Find(Channel))
+	{
+		(*BinaryChannel)->Subscribers.Remove(Handle);
+		if (!(*BinaryChannel)->Subscribers.IsBound())
+			BinaryMetadataChannels.Remove(Channel);
+	}
+
+	bHasBinaryMetadataSubscriptions = (BinaryMetadataChannels.Num() > 0);
+
+	if ((BinaryMetadataChannels.Num() == 0) && BinaryMetadataElementHandle.IsValid())
+	{
+		UnsubscribeFromMetadataElement(FName(NDIIO_BINARY_METADATA_ELEMENT), BinaryMetadataElementHandle);
+		BinaryMetadataElementHandle.Reset();
+	}
+}
+
+void UNDIMediaReceiver::DeliverBinaryMetadata(UNDIMediaReceiver* Receiver, const FNDIMetadataElement& Element)
+{
+	FAnsiStringView Channel, Encoded;
+	if (!FNDIBinaryMetadataDecoder::ParseElement(FAnsiStringView(Element.Data, Element.Length), Channel, Encoded))
+		return;
+
+	// Channels which were never subscribed to have no name
+	const FName ChannelName(Channel.Len(), Channel.GetData(), FNAME_Find);
+	const TSharedRef<FBinaryMetadataChannel>* BinaryChannelPtr = (ChannelName != NAME_None) ? BinaryMetadataChannels.Find(ChannelName) : nullptr;
+	if (BinaryChannelPtr == nullptr)
+		return;
+
+	// A subscriber may unsubscribe while being called, which removes the channel from the map
+	const TSharedRef<FBinaryMetadataChannel> BinaryChannel = *BinaryChannelPtr;
+
+	uint16 PayloadVersion = 0;
+	TArrayView<const uint8> Payload;
+	if (BinaryChannel->Decoder.Decode(Encoded, PayloadVersion, Payload))
+	{
+		const FNDIBinaryMetadataReceived Subscribers = BinaryChannel->Subscribers;
+		Subscribers.Broadcast(this, PayloadVersion, Payload);
+	}
+}
+
+void UNDIMediaReceiver::EnqueueAttachedBinaryMetadata(const char* Metadata, int64 Timecode)
+{
+	static const ANSICHAR* OpenTag = "<" NDIIO_BINARY_METADATA_ELEMENT;
+	static const ANSICHAR* CloseTag = "</" NDIIO_BINARY_METADATA_ELEMENT ">";
+	static const int32 CloseTagLength = FCStringAnsi::Strlen(CloseTag);
+
+	// The metadata of a video frame holds every element attached to it since the previous frame, one after another
+	TArray<TArray<ANSICHAR>> Elements;
+	for (const ANSICHAR* Start = FCStringAnsi::Strstr(Metadata, OpenTag); Start != nullptr; Start = FCStringAnsi::Strstr(Start, OpenTag))
+	{
+		const ANSICHAR* End = FCStringAnsi::Strstr(Start, CloseTag);
+		if (End == nullptr)
+			break;
+		End += CloseTagLength;
+
+		TArray<ANSICHAR>& Element = Elements.AddDefaulted_GetRef();
+		Element.Append(Start, End - Start);
+		Element.Add('\0');
+
+		Start = End;
+	}
+
+	if (Elements.Num() == 0)
+		return;
+
+	// In order with the other events, and never coalesced, as the delta frames need every frame before them
+	FNDIEventDispatcher::EnqueueCoalesced(this, 0, [this, Elements = MoveTemp(Elements), Timecode]()
+	{
+		for (const TArray<ANSICHAR>& Data : Elements)
+		{
+			FNDIMetadataElement Element;
+			Element.ElementName = FName(NDIIO_BINARY_METADATA_ELEMENT);
+			Element.Timecode = Timecode;
+			Element.Data = Data.GetData();
+			Element.Length = Data.Num() - 1;
+
+			DeliverBinaryMetadata(this, Element);
+		}
+	});
+}
+
+bool UNDIMediaReceiver::IsMetadataElementSubscribed(FName ElementName) const
+{
+	return BlueprintMetadataSubscriptions.Contains(ElementName) || MetadataSubscriptions.Contains(ElementName);
+}
+
+void UNDIMediaReceiver::StartMetadataCapture()
+{
+	if (!MetadataCapture.IsValid())
+	{
+		MetadataCapture = MakeShared<FNDIMediaMetadataCapture, ESPMode::ThreadSafe>([this](const NDIlib_metadata_frame_t& metadata)
+		{
+			if (metadata.p_data)
+			{
+				// Ensure that we inform all those interested when the stream starts up
+				SetIsCurrentlyConnected(true);
+
+				if (metadata.length > 0)
+					OnNDIReceiverMetadataCaptureEvent.Broadcast(this, metadata);
+			}
+		});
+
+		for (const FName& ElementName : BlueprintMetadataSubscriptions)
+			MetadataCapture->Subscribe(ElementName);
+		for (const auto& Subscription : MetadataSubscriptions)
+			MetadataCapture->Subscribe(Subscription.Key);
+	}
+
+	MetadataCapture->SetInstance(ReceiverInstance);
+
+	if (!BeginFrameHandle.IsValid())
+		BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddUObject(this, &UNDIMediaReceiver::DispatchMetadata);
+}
+
+void UNDIMediaReceiver::StopMetadataCapture()
+{
+	FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+	BeginFrameHandle.Reset();
+
+	if (MetadataCapture.IsValid())
+	{
+		// The capture thread may be waiting on the receiver for a while, so it is left to the reaper to join it
+		MetadataCapture->ClearCapturedFunction();
+		MetadataCapture->SetInstance(nullptr);
+		FNDIMediaReaper::Retire([RetiredCapture = MoveTemp(MetadataCapture)]() mutable
+		{
+			RetiredCapture.Reset();
+		});
+	}
+}
+
+void UNDIMediaReceiver::DispatchMetadata()
+{
+	if (!MetadataCapture.IsValid())
+		return;
+
+	// All frames are kept while Blueprint listens to every frame, otherwise only those subscribed to
+	MetadataCapture->SetWantsAllElements(OnReceiverMetaDataReceived.IsBound());
+	MetadataCapture->SetCapacity(MaxQueuedMetaDataFrames);
+
+	FNDIMediaMetadataFrame Frame;
+	int32 Budget = FMath::Max(MetaDataFramesPerFrame, 1);
+
+	if (bLatestMetaDataOnly)
+	{
+		// Of the frames taken this frame, only the latest of each root element is delivered.  Binary metadata is
+		// the exception, as its delta frames can only be decoded with every frame before them
+		static const FName BinaryElementName(NDIIO_BINARY_METADATA_ELEMENT);
+
+		// Frames which were not subscribed to are queued without a name, so they are told apart by their root element
+		TMap<FString, FNDIMediaMetadataFrame> LatestFrames;
+		for (; (Budget > 0) && MetadataCapture->Dequeue(Frame); --Budget)
+		{
+			if (Frame.ElementName == BinaryElementName)
+			{
+				DeliverMetadataFrame(Frame);
+			}
+			else
+			{
+				FString ElementKey = Frame.ElementName.IsNone()
+					? FNDIMediaMetadataCapture::GetRootElementString(Frame.Data.GetData(), Frame.Data.Num() - 1)
+					: Frame.ElementName.ToString();
+				LatestFrames.Add(MoveTemp(ElementKey), MoveTemp(Frame));
+			}
+		}
+
+		for (const auto& LatestFrame : LatestFrames)
+			DeliverMetadataFrame(LatestFrame.Value);
+		return;
+	}
+
+	for (; (Budget > 0) && MetadataCapture->Dequeue(Frame); --Budget)
+		DeliverMetadataFrame(Frame);
+}
+
+void UNDIMediaReceiver::DeliverMetadataFrame(const FNDIMediaMetadataFrame& Frame)
+{
+	FNDIMetadataElement Element;
+	Element.ElementName = Frame.ElementName;
+	Element.Timecode = Frame.Timecode;
+	Element.Data = Frame.Data.GetData();
+	Element.Length = Frame.Data.Num() - 1;
+
+	if (const FNDIMetadataElementReceived* Subscription = MetadataSubscriptions.Find(Frame.ElementName))
+	{
+		// A subscriber may unsubscribe while being called, which removes the subscription from the map
+		const FNDIMetadataElementReceived Subscribers = *Subscription;
+		Subscribers.Broadcast(this, Element);
+	}
+
+	// Decoded for Blueprint only, and only once
+	const bool bDeliverElement = BlueprintMetadataSubscriptions.Contains(Frame.ElementName) && OnReceiverMetaDataElementReceived.IsBound();
+	if (bDeliverElement || OnReceiverMetaDataReceived.IsBound())
+	{
+		const FString Data = Element.ToString();
+
+		if (bDeliverElement)
+			OnReceiverMetaDataElementReceived.Broadcast(this, Frame.ElementName, Data);
+		if (OnReceiverMetaDataReceived.IsBound())
+			OnReceiverMetaDataReceived.Broadcast(this, Data, false);
+	}
+}
+
+void UNDIMediaReceiver::SetIsCurrentlyConnected(bool bConnected)
+{
+	if (bConnected != bIsCurrentlyConnected)
+	{
+		FScopeLock Lock(&ConnectionSyncContext);
+
+		if (bConnected != bIsCurrentlyConnected)
+		{
+			bIsCurrentlyConnected = bConnected;
+			ConnectedTime = bConnected ? FPlatformTime::Seconds() : 0.0;
+
+			if (bConnected == true)
 			{
 				if (OnNDIReceiverConnectedEvent.IsBound())
 				{
-					AsyncTask(ENamedThreads::GameThread, [&]() {
+					FNDIEventDispatcher::Enqueue(this, [this]() {
 						// Broadcast the event
 						OnNDIReceiverConnectedEvent.Broadcast(this);
 					});
@@ -830,7 +1517,7 @@ void UNDIMediaReceiver::SetIsCurrentlyConnected(bool bConnected)
 			{
 				if (OnNDIReceiverDisconnectedEvent.IsBound())
 				{
-					AsyncTask(ENamedThreads::GameThread, [&]() {
+					FNDIEventDispatcher::Enqueue(this, [this]() {
 						// Broadcast the event
 						OnNDIReceiverDisconnectedEvent.Broadcast(this);
 					});
@@ -847,82 +1534,232 @@ void UNDIMediaReceiver::SetIsCurrentlyConnected(bool bConnected)
 */
 FTextureRHIRef UNDIMediaReceiver::DisplayFrame(const NDIlib_video_frame_v2_t& video_frame)
 {
+	// Ensure thread safety
+	FScopeLock Lock(&RenderSyncContext);
+
+	// The same frame can be displayed through several paths (e.g. the video texture and a media player),
+	// so if it was the last one converted, hand out the result of that conversion again
+	const FConvertedFrameKey FrameKey(video_frame, bPerformsRGBtoLinear);
+	if (FrameKey.IsCacheable() && (FrameKey == LastConvertedFrameKey) && RenderTarget.IsValid())
+		return RenderTarget->GetRHI();
+
 	// we need a command list to work with
 	FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
 
+	FTextureRHIRef ConversionTexture;
+
 	// Actually draw the video frame from cpu to gpu
 	switch(video_frame.frame_format_type)
 	{
 		case NDIlib_frame_format_type_progressive:
 			if(video_frame.FourCC == NDIlib_FourCC_video_type_UYVY)
-				return DrawProgressiveVideoFrame(RHICmdList, video_frame);
+				ConversionTexture = DrawProgressiveVideoFrame(RHICmdList, video_frame);
 			else if(video_frame.FourCC == NDIlib_FourCC_video_type_UYVA)
-				return DrawProgressiveVideoFrameAlpha(RHICmdList, video_frame);
+				ConversionTexture = DrawProgressiveVideoFrameAlpha(RHICmdList, video_frame);
 			break;
 		case NDIlib_frame_format_type_field_0:
 		case NDIlib_frame_format_type_field_1:
 			if(video_frame.FourCC == NDIlib_FourCC_video_type_UYVY)
-				return DrawInterlacedVideoFrame(RHICmdList, video_frame);
+				ConversionTexture = DrawInterlacedVideoFrame(RHICmdList, video_frame);
 			else if(video_frame.FourCC == NDIlib_FourCC_video_type_UYVA)
-				return DrawInterlacedVideoFrameAlpha(RHICmdList, video_frame);
+				ConversionTexture = DrawInterlacedVideoFrameAlpha(RHICmdList, video_frame);
 			break;
 	}
 
-	return nullptr;
+	LastConvertedFrameKey = (ConversionTexture != nullptr) ? FrameKey : FConvertedFrameKey();
+
+	return ConversionTexture;
 }
 
 /**
-	Perform the color conversion (if any) and bit copy from the gpu
+	Makes the source textures and render target for the given frame size and draw mode current, taking them from the
+	conversion cache if they were used recently, or creating them (and evicting the least recently used entries
+	beyond the memory budget) otherwise
 */
-FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrame(FRHICommandListImmediate& RHICmdList, const NDIlib_video_frame_v2_t& Result)
+bool UNDIMediaReceiver::AcquireConversionResources(FRHICommandListImmediate& RHICmdList, const FIntPoint& SourceSize, const FIntPoint& FrameSize, EDrawMode InDrawMode)
 {
 	// Ensure thread safety
 	FScopeLock Lock(&RenderSyncContext);
 
-	FTextureRHIRef TargetableTexture;
+	++ConversionCacheUseCount;
 
-	// check for our frame sync object and that we are actually connected to the end point
-	if (p_framesync_instance != nullptr)
+	FConversionResources* CachedResources = ConversionCache.FindByPredicate([&](const FConversionResources& Resources)
 	{
-		// Initialize the frame size parameter
-		FIntPoint FrameSize = FIntPoint(Result.xres, Result.yres);
+		return (Resources.DrawMode == InDrawMode) && (Resources.FrameSize == FrameSize);
+	});
 
-		if (!RenderTarget.IsValid() || !RenderTargetDescriptor.IsValid() ||
-			RenderTargetDescriptor.GetSize() != FIntVector(FrameSize.X, FrameSize.Y, 0) ||
-			DrawMode != EDrawMode::Progressive)
+	if (CachedResources != nullptr)
+	{
+		++ConversionCacheStats.Hits;
+	}
+	else
+	{
+		++ConversionCacheStats.Misses;
+
+		const bool bHasAlpha = (InDrawMode == EDrawMode::ProgressiveAlpha) || (InDrawMode == EDrawMode::InterlacedAlpha);
+
+		const TCHAR* SourceTextureName = TEXT("NDIMediaReceiverProgressiveSourceTexture");
+		const TCHAR* SourceAlphaTextureName = TEXT("NDIMediaReceiverProgressiveAlphaSourceAlphaTexture");
+		switch (InDrawMode)
 		{
-			// Create the RenderTarget descriptor
-			RenderTargetDescriptor = FPooledRenderTargetDesc::Create2DDesc(
-				FrameSize, PF_B8G8R8A8, FClearValueBinding::None, TexCreate_None, TexCreate_RenderTargetable | TexCreate_SRGB, false);
+			case EDrawMode::ProgressiveAlpha:
+				SourceTextureName = TEXT("NDIMediaReceiverProgressiveAlphaSourceTexture");
+				break;
+			case EDrawMode::Interlaced:
+				SourceTextureName = TEXT("NDIMediaReceiverInterlacedSourceTexture");
+				break;
+			case EDrawMode::InterlacedAlpha:
+				SourceTextureName = TEXT("NDIMediaReceiverInterlacedAlphaSourceTexture");
+				SourceAlphaTextureName = TEXT("NDIMediaReceiverInterlacedAlphaSourceAlphaTexture");
+				break;
+			default:
+				break;
+		}
 
-			// Update the shader resource for the 'SourceTexture'
-			// The source texture will be given UYVY data, so make it half-width
+		FConversionResources Resources;
+		Resources.DrawMode = InDrawMode;
+		Resources.FrameSize = FrameSize;
+
+		// Create the RenderTarget descriptor
+		Resources.RenderTargetDescriptor = FPooledRenderTargetDesc::Create2DDesc(
+			FrameSize, PF_B8G8R8A8, FClearValueBinding::None, TexCreate_None, TexCreate_RenderTargetable | TexCreate_SRGB, false);
+
+		// Update the shader resource for the 'SourceTexture'
+		// The source texture will be given UYVY data, so make it half-width
 #if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))	// 5.1 or later
-			const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaReceiverProgressiveSourceTexture"))
-				.SetExtent(FrameSize.X / 2, FrameSize.Y)
-				.SetFormat(PF_B8G8R8A8)
+		const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(SourceTextureName)
+			.SetExtent(SourceSize.X / 2, SourceSize.Y)
+			.SetFormat(PF_B8G8R8A8)
+			.SetNumMips(1)
+			.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
+
+		Resources.SourceTexture = RHICreateTexture(CreateDesc);
+
+		if (bHasAlpha)
+		{
+			const FRHITextureCreateDesc CreateAlphaDesc = FRHITextureCreateDesc::Create2D(SourceAlphaTextureName)
+				.SetExtent(SourceSize.X, SourceSize.Y)
+				.SetFormat(PF_A8)
 				.SetNumMips(1)
 				.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
 
-			SourceTexture = RHICreateTexture(CreateDesc);
+			Resources.SourceAlphaTexture = RHICreateTexture(CreateAlphaDesc);
+		}
 #elif (ENGINE_MAJOR_VERSION == 5)
-			FRHIResourceCreateInfo CreateInfo(TEXT("NDIMediaReceiverProgressiveSourceTexture"));
-			TRefCountPtr<FRHITexture2D> DummyTexture2DRHI;
-			RHICreateTargetableShaderResource2D(FrameSize.X / 2, FrameSize.Y, PF_B8G8R8A8, 1, TexCreate_Dynamic,
-			                                    TexCreate_RenderTargetable, false, CreateInfo, SourceTexture,
-			                                    DummyTexture2DRHI);
+		FRHIResourceCreateInfo CreateInfo(SourceTextureName);
+		TRefCountPtr<FRHITexture2D> DummyTexture2DRHI;
+		RHICreateTargetableShaderResource2D(SourceSize.X / 2, SourceSize.Y, PF_B8G8R8A8, 1, TexCreate_Dynamic,
+		                                    TexCreate_RenderTargetable, false, CreateInfo, Resources.SourceTexture,
+		                                    DummyTexture2DRHI);
+
+		if (bHasAlpha)
+		{
+			FRHIResourceCreateInfo CreateAlphaInfo(SourceAlphaTextureName);
+			TRefCountPtr<FRHITexture2D> DummyAlphaTexture2DRHI;
+			RHICreateTargetableShaderResource2D(SourceSize.X, SourceSize.Y, PF_A8, 1, TexCreate_Dynamic,
+			                                    TexCreate_RenderTargetable, false, CreateAlphaInfo, Resources.SourceAlphaTexture,
+			                                    DummyAlphaTexture2DRHI);
+		}
 #else
-			#error "Unsupported engine major version"
+		#error "Unsupported engine major version"
 #endif
 
-			// Find a free target-able texture from the render pool
-			GRenderTargetPool.FindFreeElement(RHICmdList, RenderTargetDescriptor, RenderTarget, TEXT("NDIIO"));
+		// Find a free target-able texture from the render pool
+		GRenderTargetPool.FindFreeElement(RHICmdList, Resources.RenderTargetDescriptor, Resources.RenderTarget, TEXT("NDIIO"));
 
-			DrawMode = EDrawMode::Progressive;
+		if (!Resources.RenderTarget.IsValid())
+			return false;
+
+		// Approximate memory use: the BGRA render target, the half-width BGRA source and the optional A8 alpha source
+		Resources.SizeInBytes = (int64)FrameSize.X * FrameSize.Y * 4 +
+								(int64)(SourceSize.X / 2) * SourceSize.Y * 4 + (bHasAlpha ? (int64)SourceSize.X * SourceSize.Y : 0);
+
+		CachedResources = &ConversionCache.Add_GetRef(MoveTemp(Resources));
+	}
+
+	CachedResources->LastUseCount = ConversionCacheUseCount;
+
+	SourceTexture = CachedResources->SourceTexture;
+	SourceAlphaTexture = CachedResources->SourceAlphaTexture;
+	RenderTargetDescriptor = CachedResources->RenderTargetDescriptor;
+	RenderTarget = CachedResources->RenderTarget;
+	DrawMode = InDrawMode;
+
+	// Evict the least recently used entries which don't fit the budget, never the one we are about to use
+	const int64 MaxBytes = (int64)FMath::Max(ConversionCacheSize, 0) * 1024 * 1024;
+	for (;;)
+	{
+		int64 TotalBytes = 0;
+		int32 LeastRecentlyUsed = INDEX_NONE;
+		for (int32 Index = 0; Index < ConversionCache.Num(); ++Index)
+		{
+			TotalBytes += ConversionCache[Index].SizeInBytes;
+			if ((ConversionCache[Index].LastUseCount != ConversionCacheUseCount) &&
+				((LeastRecentlyUsed == INDEX_NONE) || (ConversionCache[Index].LastUseCount < ConversionCache[LeastRecentlyUsed].LastUseCount)))
+			{
+				LeastRecentlyUsed = Index;
+			}
 		}
 
+		ConversionCacheStats.Entries = ConversionCache.Num();
+		ConversionCacheStats.Bytes = TotalBytes;
+
+		if ((TotalBytes <= MaxBytes) || (LeastRecentlyUsed == INDEX_NONE))
+			break;
+
+		ConversionCache.RemoveAtSwap(LeastRecentlyUsed);
+		++ConversionCacheStats.Evictions;
+	}
+
+	return true;
+}
+
+/**
+	Copies the rows of a received frame into a source texture.  The RHI stages the copy and orders it against the GPU
+	work still reading the texture, so a single source texture per size and draw mode is enough
+*/
+static void UploadSourceTexture(FRHITexture2D* Texture, const uint8* SourceData, uint32 SourceStride, uint32 Width, uint32 NumRows)
+{
+	FUpdateTextureRegion2D Region(0, 0, 0, 0, Width, NumRows);
+
+	RHIUpdateTexture2D(Texture, 0, Region, SourceStride, SourceData);
+}
+
+/**
+	Returns the statistics of the cache of textures used to convert the received frames
+*/
+UNDIMediaReceiver::FConversionCacheStats UNDIMediaReceiver::GetConversionCacheStats() const
+{
+	FScopeLock Lock(&RenderSyncContext);
+
+	return ConversionCacheStats;
+}
+
+/**
+	Perform the color conversion (if any) and bit copy from the gpu
+*/
+FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrame(FRHICommandListImmediate& RHICmdList, const NDIlib_video_frame_v2_t& Result)
+{
+	// Ensure thread safety
+	FScopeLock Lock(&RenderSyncContext);
+
+	FTextureRHIRef TargetableTexture;
+
+	// check for our frame sync object and that we are actually connected to the end point
+	if (p_framesync_instance != nullptr)
+	{
+		// Initialize the frame size parameter
+		FIntPoint FrameSize = FIntPoint(Result.xres, Result.yres);
+
+		// Pick up the textures for this frame size and mode, reusing them if they were used recently
+		if (!AcquireConversionResources(RHICmdList, FrameSize, FrameSize, EDrawMode::Progressive))
+			return TargetableTexture;
+
 		TargetableTexture = RenderTarget->GetRHI();
 
+		// Set the Pixel data of the NDI Frame to the SourceTexture
+		UploadSourceTexture(SourceTexture, Result.p_data, Result.line_stride_in_bytes, FrameSize.X / 2, FrameSize.Y);
+
 		// Initialize the Graphics Pipeline State Object
 		FGraphicsPipelineStateInitializer GraphicsPSOInit;
 
@@ -970,12 +1807,6 @@ FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrame(FRHICommandListImmed
 		                                        FVector2D(0.f, 1.f));
 		ConvertShader->SetParameters(RHICmdList, Params);
 
-		// Create the update region structure
-		FUpdateTextureRegion2D Region(0, 0, 0, 0, FrameSize.X/2, FrameSize.Y);
-
-		// Set the Pixel data of the NDI Frame to the SourceTexture
-		RHIUpdateTexture2D(SourceTexture, 0, Region, Result.line_stride_in_bytes, (uint8*&)Result.p_data);
-
 		// begin our drawing
 		{
 			RHICmdList.SetViewport(0, 0, 0.0f, FrameSize.X, FrameSize.Y, 1.0f);
@@ -1001,55 +1832,16 @@ FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrameAlpha(FRHICommandList
 		// Initialize the frame size parameter
 		FIntPoint FrameSize = FIntPoint(Result.xres, Result.yres);
 
-		if (!RenderTarget.IsValid() || !RenderTargetDescriptor.IsValid() ||
-			RenderTargetDescriptor.GetSize() != FIntVector(FrameSize.X, FrameSize.Y, 0) ||
-			DrawMode != EDrawMode::ProgressiveAlpha)
-		{
-			// Create the RenderTarget descriptor
-			RenderTargetDescriptor = FPooledRenderTargetDesc::Create2DDesc(
-				FrameSize, PF_B8G8R8A8, FClearValueBinding::None, TexCreate_None, TexCreate_RenderTargetable | TexCreate_SRGB, false);
-
-			// Update the shader resource for the 'SourceTexture'
-			// The source texture will be given UYVY data, so make it half-width
-#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))	// 5.1 or later
-			const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaReceiverProgressiveAlphaSourceTexture"))
-				.SetExtent(FrameSize.X / 2, FrameSize.Y)
-				.SetFormat(PF_B8G8R8A8)
-				.SetNumMips(1)
-				.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
-
-			SourceTexture = RHICreateTexture(CreateDesc);
-
-			const FRHITextureCreateDesc CreateAlphaDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaReceiverProgressiveAlphaSourceAlphaTexture"))
-				.SetExtent(FrameSize.X, FrameSize.Y)
-				.SetFormat(PF_A8)
-				.SetNumMips(1)
-				.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
-
-			SourceAlphaTexture = RHICreateTexture(CreateAlphaDesc);
-#elif (ENGINE_MAJOR_VERSION == 5)
-			FRHIResourceCreateInfo CreateInfo(TEXT("NDIMediaReceiverProgressiveAlphaSourceTexture"));
-			TRefCountPtr<FRHITexture2D> DummyTexture2DRHI;
-			RHICreateTargetableShaderResource2D(FrameSize.X/2, FrameSize.Y, PF_B8G8R8A8, 1, TexCreate_Dynamic,
-												TexCreate_RenderTargetable, false, CreateInfo, SourceTexture,
-												DummyTexture2DRHI);
-			FRHIResourceCreateInfo CreateAlphaInfo(TEXT("NDIMediaReceiverProgressiveAlphaSourceAlphaTexture"));
-			TRefCountPtr<FRHITexture2D> DummyAlphaTexture2DRHI;
-			RHICreateTargetableShaderResource2D(FrameSize.X, FrameSize.Y, PF_A8, 1, TexCreate_Dynamic,
-												TexCreate_RenderTargetable, false, CreateAlphaInfo, SourceAlphaTexture,
-												DummyAlphaTexture2DRHI);
-#else
-			#error "Unsupported engine major version"
-#endif
-
-			// Find a free target-able texture from the render pool
-			GRenderTargetPool.FindFreeElement(RHICmdList, RenderTargetDescriptor, RenderTarget, TEXT("NDIIO"));
-
-			DrawMode = EDrawMode::ProgressiveAlpha;
-		}
+		// Pick up the textures for this frame size and mode, reusing them if they were used recently
+		if (!AcquireConversionResources(RHICmdList, FrameSize, FrameSize, EDrawMode::ProgressiveAlpha))
+			return TargetableTexture;
 
 		TargetableTexture = RenderTarget->GetRHI();
 
+		// Set the Pixel data of the NDI Frame to the SourceTexture, the alpha plane follows the UYVY data
+		UploadSourceTexture(SourceTexture, Result.p_data, Result.line_stride_in_bytes, FrameSize.X / 2, FrameSize.Y);
+		UploadSourceTexture(SourceAlphaTexture, Result.p_data + FrameSize.Y * Result.line_stride_in_bytes, FrameSize.X, FrameSize.X, FrameSize.Y);
+
 		// Initialize the Graphics Pipeline State Object
 		FGraphicsPipelineStateInitializer GraphicsPSOInit;
 
@@ -1098,14 +1890,6 @@ FTextureRHIRef UNDIMediaReceiver::DrawProgressiveVideoFrameAlpha(FRHICommandList
 		                                        FVector2D(0.f, 1.f));
 		ConvertShader->SetParameters(RHICmdList, Params);
 
-		// Create the update region structure
-		FUpdateTextureRegion2D Region(0, 0, 0, 0, FrameSize.X/2, FrameSize.Y);
-		FUpdateTextureRegion2D AlphaRegion(0, 0, 0, 0, FrameSize.X, FrameSize.Y);
-
-		// Set the Pixel data of the NDI Frame to the SourceTexture
-		RHIUpdateTexture2D(SourceTexture, 0, Region, Result.line_stride_in_bytes, (uint8*&)Result.p_data);
-		RHIUpdateTexture2D(SourceAlphaTexture, 0, AlphaRegion, FrameSize.X, ((uint8*&)Result.p_data)+FrameSize.Y*Result.line_stride_in_bytes);
-
 		// begin our drawing
 		{
 			RHICmdList.SetViewport(0, 0, 0.0f, FrameSize.X, FrameSize.Y, 1.0f);
@@ -1133,42 +1917,15 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrame(FRHICommandListImmedi
 		FIntPoint FieldSize = FIntPoint(Result.xres, Result.yres);
 		FIntPoint FrameSize = FIntPoint(Result.xres, Result.yres*2);
 
-		if (!RenderTarget.IsValid() || !RenderTargetDescriptor.IsValid() ||
-			RenderTargetDescriptor.GetSize() != FIntVector(FrameSize.X, FrameSize.Y, 0) ||
-			DrawMode != EDrawMode::Interlaced)
-		{
-			// Create the RenderTarget descriptor
-			RenderTargetDescriptor = FPooledRenderTargetDesc::Create2DDesc(
-				FrameSize, PF_B8G8R8A8, FClearValueBinding::None, TexCreate_None, TexCreate_RenderTargetable | TexCreate_SRGB, false);
-
-			// Update the shader resource for the 'SourceTexture'
-			// The source texture will be given UYVY data, so make it half-width
-#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))	// 5.1 or later
-			const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaReceiverInterlacedSourceTexture"))
-				.SetExtent(FieldSize.X / 2, FieldSize.Y)
-				.SetFormat(PF_B8G8R8A8)
-				.SetNumMips(1)
-				.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
-
-			SourceTexture = RHICreateTexture(CreateDesc);
-#elif (ENGINE_MAJOR_VERSION == 5)
-			FRHIResourceCreateInfo CreateInfo(TEXT("NDIMediaReceiverInterlacedSourceTexture"));
-			TRefCountPtr<FRHITexture2D> DummyTexture2DRHI;
-			RHICreateTargetableShaderResource2D(FieldSize.X/2, FieldSize.Y, PF_B8G8R8A8, 1, TexCreate_Dynamic,
-												TexCreate_RenderTargetable, false, CreateInfo, SourceTexture,
-												DummyTexture2DRHI);
-#else
-			#error "Unsupported engine major version"
-#endif
-
-			// Find a free target-able texture from the render pool
-			GRenderTargetPool.FindFreeElement(RHICmdList, RenderTargetDescriptor, RenderTarget, TEXT("NDIIO"));
-
-			DrawMode = EDrawMode::Interlaced;
-		}
+		// Pick up the textures for this frame size and mode, reusing them if they were used recently
+		if (!AcquireConversionResources(RHICmdList, FieldSize, FrameSize, EDrawMode::Interlaced))
+			return TargetableTexture;
 
 		TargetableTexture = RenderTarget->GetRHI();
 
+		// Set the Pixel data of the NDI Frame to the SourceTexture
+		UploadSourceTexture(SourceTexture, Result.p_data, Result.line_stride_in_bytes, FieldSize.X / 2, FieldSize.Y);
+
 		// Initialize the Graphics Pipeline State Object
 		FGraphicsPipelineStateInitializer GraphicsPSOInit;
 
@@ -1217,12 +1974,6 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrame(FRHICommandListImmedi
 		                                        FVector2D(0.f, 1.f));
 		ConvertShader->SetParameters(RHICmdList, Params);
 
-		// Create the update region structure
-		FUpdateTextureRegion2D Region(0, 0, 0, 0, FieldSize.X/2, FieldSize.Y);
-
-		// Set the Pixel data of the NDI Frame to the SourceTexture
-		RHIUpdateTexture2D(SourceTexture, 0, Region, Result.line_stride_in_bytes, (uint8*&)Result.p_data);
-
 		// begin our drawing
 		{
 			RHICmdList.SetViewport(0, 0, 0.0f, FrameSize.X, FrameSize.Y, 1.0f);
@@ -1249,55 +2000,16 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrameAlpha(FRHICommandListI
 		FIntPoint FieldSize = FIntPoint(Result.xres, Result.yres);
 		FIntPoint FrameSize = FIntPoint(Result.xres, Result.yres*2);
 
-		if (!RenderTarget.IsValid() || !RenderTargetDescriptor.IsValid() ||
-			RenderTargetDescriptor.GetSize() != FIntVector(FrameSize.X, FrameSize.Y, 0) ||
-			DrawMode != EDrawMode::InterlacedAlpha)
-		{
-			// Create the RenderTarget descriptor
-			RenderTargetDescriptor = FPooledRenderTargetDesc::Create2DDesc(
-				FrameSize, PF_B8G8R8A8, FClearValueBinding::None, TexCreate_None, TexCreate_RenderTargetable | TexCreate_SRGB, false);
-
-			// Update the shader resource for the 'SourceTexture'
-			// The source texture will be given UYVY data, so make it half-width
-#if (ENGINE_MAJOR_VERSION > 5) || ((ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION >= 1))	// 5.1 or later
-			const FRHITextureCreateDesc CreateDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaReceiverInterlacedAlphaSourceTexture"))
-				.SetExtent(FieldSize.X / 2, FieldSize.Y)
-				.SetFormat(PF_B8G8R8A8)
-				.SetNumMips(1)
-				.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
-
-			SourceTexture = RHICreateTexture(CreateDesc);
-
-			const FRHITextureCreateDesc CreateAlphaDesc = FRHITextureCreateDesc::Create2D(TEXT("NDIMediaReceiverInterlacedAlphaSourceAlphaTexture"))
-				.SetExtent(FieldSize.X, FieldSize.Y)
-				.SetFormat(PF_A8)
-				.SetNumMips(1)
-				.SetFlags(ETextureCreateFlags::RenderTargetable | ETextureCreateFlags::Dynamic);
-
-			SourceAlphaTexture = RHICreateTexture(CreateAlphaDesc);
-#elif (ENGINE_MAJOR_VERSION == 5)
-			FRHIResourceCreateInfo CreateInfo(TEXT("NDIMediaReceiverInterlacedAlphaSourceTexture"));
-			TRefCountPtr<FRHITexture2D> DummyTexture2DRHI;
-			RHICreateTargetableShaderResource2D(FieldSize.X/2, FieldSize.Y, PF_B8G8R8A8, 1, TexCreate_Dynamic,
-												TexCreate_RenderTargetable, false, CreateInfo, SourceTexture,
-												DummyTexture2DRHI);
-			FRHIResourceCreateInfo CreateAlphaInfo(TEXT("NDIMediaReceiverInterlacedAlphaSourceAlphaTexture"));
-			TRefCountPtr<FRHITexture2D> DummyAlphaTexture2DRHI;
-			RHICreateTargetableShaderResource2D(FieldSize.X, FieldSize.Y, PF_A8, 1, TexCreate_Dynamic,
-												TexCreate_RenderTargetable, false, CreateAlphaInfo, SourceAlphaTexture,
-												DummyAlphaTexture2DRHI);
-#else
-			#error "Unsupported engine major version"
-#endif
-
-			// Find a free target-able texture from the render pool
-			GRenderTargetPool.FindFreeElement(RHICmdList, RenderTargetDescriptor, RenderTarget, TEXT("NDIIO"));
-
-			DrawMode = EDrawMode::InterlacedAlpha;
-		}
+		// Pick up the textures for this frame size and mode, reusing them if they were used recently
+		if (!AcquireConversionResources(RHICmdList, FieldSize, FrameSize, EDrawMode::InterlacedAlpha))
+			return TargetableTexture;
 
 		TargetableTexture = RenderTarget->GetRHI();
 
+		// Set the Pixel data of the NDI Frame to the SourceTexture, the alpha plane follows the UYVY data
+		UploadSourceTexture(SourceTexture, Result.p_data, Result.line_stride_in_bytes, FieldSize.X / 2, FieldSize.Y);
+		UploadSourceTexture(SourceAlphaTexture, Result.p_data + FieldSize.Y * Result.line_stride_in_bytes, FieldSize.X, FieldSize.X, FieldSize.Y);
+
 		// Initialize the Graphics Pipeline State Object
 		FGraphicsPipelineStateInitializer GraphicsPSOInit;
 
@@ -1346,14 +2058,6 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrameAlpha(FRHICommandListI
 		                                        FVector2D(0.f, 1.f));
 		ConvertShader->SetParameters(RHICmdList, Params);
 
-		// Create the update region structure
-		FUpdateTextureRegion2D Region(0, 0, 0, 0, FieldSize.X/2, FieldSize.Y);
-		FUpdateTextureRegion2D AlphaRegion(0, 0, 0, 0, FieldSize.X, FieldSize.Y);
-
-		// Set the Pixel data of the NDI Frame to the SourceTexture
-		RHIUpdateTexture2D(SourceTexture, 0, Region, Result.line_stride_in_bytes, (uint8*&)Result.p_data);
-		RHIUpdateTexture2D(SourceAlphaTexture, 0, AlphaRegion, FieldSize.X, ((uint8*&)Result.p_data)+FieldSize.Y*Result.line_stride_in_bytes);
-
 		// begin our drawing
 		{
 			RHICmdList.SetViewport(0, 0, 0.0f, FrameSize.X, FrameSize.Y, 1.0f);
@@ -1371,14 +2075,68 @@ FTextureRHIRef UNDIMediaReceiver::DrawInterlacedVideoFrameAlpha(FRHICommandListI
 */
 void UNDIMediaReceiver::GatherPerformanceMetrics()
 {
+	// Only sample the SDK at the configured rate
+	const double Now = FPlatformTime::Seconds();
+	if ((PerformanceSamplingRate > 0.f) && ((Now - LastPerformanceSampleTime) < (1.0 / PerformanceSamplingRate)))
+		return;
+
+	const double SampleInterval = (LastPerformanceSampleTime > 0.0) ? (Now - LastPerformanceSampleTime) : 0.0;
+	LastPerformanceSampleTime = Now;
+
 	// provide references to store the values
 	NDIlib_recv_performance_t stable_performance;
 	NDIlib_recv_performance_t dropped_performance;
+	NDIlib_recv_queue_t queue;
 
 	// get the performance values from the SDK
-	NDIlib_recv_get_performance(p_receive_instance, &stable_performance, &dropped_performance);
+	const TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> Instance = GetReceiverInstance();
+	if (!Instance.IsValid())
+		return;
+
+	NDIlib_recv_get_performance(Instance->GetReceiveInstance(), &stable_performance, &dropped_performance);
+	NDIlib_recv_get_queue(Instance->GetReceiveInstance(), &queue);
+
+	const double DataRate = (SampleInterval > 0.0) ? ((DecodedVideoBytes * 8.0) / (SampleInterval * 1e6)) : 0.0;
+	if (SampleInterval > 0.0)
+		DecodedVideoBytes = 0;
+
+	PerformanceWindow.VideoQueueDepth.Add(queue.video_frames);
+	PerformanceWindow.AudioQueueDepth.Add(queue.audio_frames);
+	if (SampleInterval > 0.0)
+		PerformanceWindow.DecodedVideoDataRates.Add(DataRate);
+
+	const double Connected = ConnectedTime;
+
+	FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+
+	// Publish the histograms once their window is complete
+	if (PerformanceWindow.StartTime <= 0.0)
+	{
+		PerformanceWindow.StartTime = Now;
+	}
+	else if ((Now - PerformanceWindow.StartTime) >= PerformanceHistogramWindow)
+	{
+		this->PerformanceData.ArrivalJitter = PerformanceWindow.ArrivalJitter;
+		this->PerformanceData.Latency = PerformanceWindow.Latency;
+		this->PerformanceData.VideoQueueDepth = PerformanceWindow.VideoQueueDepth;
+		this->PerformanceData.AudioQueueDepth = PerformanceWindow.AudioQueueDepth;
+		this->PerformanceData.DecodedVideoDataRates = PerformanceWindow.DecodedVideoDataRates;
+
+		PerformanceWindow.ArrivalJitter.Reset();
+		PerformanceWindow.Latency.Reset();
+		PerformanceWindow.VideoQueueDepth.Reset();
+		PerformanceWindow.AudioQueueDepth.Reset();
+		PerformanceWindow.DecodedVideoDataRates.Reset();
+		PerformanceWindow.StartTime = Now;
+	}
 
 	// update our structure with the updated values
+	this->PerformanceData.QueuedVideoFrames = queue.video_frames;
+	this->PerformanceData.QueuedAudioFrames = queue.audio_frames;
+	this->PerformanceData.QueuedMetadataFrames = queue.metadata_frames;
+	this->PerformanceData.ConnectionUptime = (Connected > 0.0) ? float(Now - Connected) : 0.f;
+	if (SampleInterval > 0.0)
+		this->PerformanceData.DecodedVideoDataRate = float(DataRate);
 	this->PerformanceData.AudioFrames = stable_performance.audio_frames;
 	this->PerformanceData.DroppedAudioFrames = dropped_performance.audio_frames;
 	this->PerformanceData.DroppedMetadataFrames = dropped_performance.metadata_frames;
@@ -1390,8 +2148,9 @@ void UNDIMediaReceiver::GatherPerformanceMetrics()
 /**
 	Returns the current performance data of the receiver while connected to the source
 */
-const FNDIReceiverPerformanceData& UNDIMediaReceiver::GetPerformanceData() const
+FNDIReceiverPerformanceData UNDIMediaReceiver::GetPerformanceData() const
 {
+	FScopeLock Lock(&PerformanceDataSyncContext);
 	return this->PerformanceData;
 }
 
@@ -1507,6 +2266,14 @@ FTextureResource* UNDIMediaReceiver::GetVideoTextureResource() const
 	return nullptr;
 }
 
+UNDIMediaTexture2D* UNDIMediaReceiver::GetOrCreateInternalVideoTexture()
+{
+	if (this->InternalVideoTexture == nullptr)
+		this->InternalVideoTexture = NewObject<UNDIMediaTexture2D>(GetTransientPackage(), UNDIMediaTexture2D::StaticClass(), NAME_None, RF_Transient | RF_MarkAsNative);
+
+	return this->InternalVideoTexture;
+}
+
 FTextureResource* UNDIMediaReceiver::GetInternalVideoTextureResource() const
 {
 	if(IsValid(this->InternalVideoTexture))
@@ -1526,7 +2293,14 @@ void UNDIMediaReceiver::PostEditChangeProperty(FPropertyChangedEvent& PropertyCh
 	FName PropertyName =
 		(PropertyChangedEvent.Property != nullptr) ? PropertyChangedEvent.Property->GetFName() : NAME_None;
 
-	if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UNDIMediaReceiver, ConnectionSetting))
+	if ((MemberPropertyName == GET_MEMBER_NAME_CHECKED(UNDIMediaReceiver, Delay)) ||
+		(MemberPropertyName == GET_MEMBER_NAME_CHECKED(UNDIMediaReceiver, MaximumDelay)) ||
+		(MemberPropertyName == GET_MEMBER_NAME_CHECKED(UNDIMediaReceiver, MaximumDelayMemory)))
+	{
+		SetDelay(this->Delay);
+	}
+
+	else if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UNDIMediaReceiver, ConnectionSetting))
 	{
 		if (PropertyName == GET_MEMBER_NAME_CHECKED(FNDIConnectionInformation, SourceName))
 		{
@@ -14,6 +14,8 @@
 #include <GlobalShader.h>
 #include <ShaderParameterUtils.h>
 #include <Services/NDIConnectionService.h>
+#include <Services/NDIEventDispatcher.h>
+#include <NDIIOPluginModule.h>
 #include <MediaShaders.h>
 
 #include <Async/Async.h>
@@ -22,11 +24,21 @@
 #include <Misc/EngineVersionComparison.h>
 
 #include "NDIShaders.h"
+#include "NDIMediaReaper.h"
+#include "NDIMediaSenderPool.h"
 
 #if WITH_EDITOR
 #include <Editor.h>
 #endif
 
+/** The key under which the metadata received events of a sender are coalesced */
+static constexpr uint32 SenderMetaDataReceivedEventKey = 1;
+
+static FORCEINLINE double CyclesToMicroseconds(uint64 Cycles)
+{
+	return FPlatformTime::ToSeconds64(Cycles) * 1e6;
+}
+
 #include <string>
 
 
@@ -253,6 +265,9 @@ UNDIMediaSender::UNDIMediaSender(const FObjectInitializer& ObjectInitializer)
 */
 void UNDIMediaSender::Initialize(USoundSubmix* SubmixCapture)
 {
+	// The NDI runtime is loaded on first use of the plugin
+	FNDIIOPluginModule::EnsureNDIRuntime();
+
 	if (this->p_send_instance == nullptr)
 	{
 		// Create valid settings to be seen on the network
@@ -272,9 +287,8 @@ void UNDIMediaSender::Initialize(USoundSubmix* SubmixCapture)
 			FNDIConnectionService::EventOnSendVideoFrame.AddUObject(this, &UNDIMediaSender::TrySendVideoFrame);
 
 			// Initialize the 'LastRender' timecode
-			LastRenderTime = FTimecode::FromTimespan(0, FrameRate, FTimecode::IsDropFormatTimecodeSupported(FrameRate),
-													 true // use roll-over timecode
-			);
+			TimecodeConverter.SetFrameRate(FrameRate);
+			LastRenderTime = TimecodeConverter.FromTicks(0);
 
 #if UE_EDITOR
 
@@ -343,16 +357,28 @@ bool UNDIMediaSender::CreateSender()
 		p_send_instance = nullptr;
 	}
 
-	// Create valid settings to be seen on the network
-	NDIlib_send_create_t settings;
-	settings.clock_audio = false;
-	settings.clock_video = false;
-	// Beware of the limited lifetime of TCHAR_TO_UTF8 values
-	std::string SourceNameStr(TCHAR_TO_UTF8(*this->SourceName));
-	settings.p_ndi_name = SourceNameStr.c_str();
+	// Take over the source of a destroyed sender by the same name, such as the one in the previous level,
+	// so that its receivers stay connected
+	p_send_instance = FNDIMediaSenderPool::Claim(this->SourceName);
 
-	// create the instance and store it
-	p_send_instance = NDIlib_send_create(&settings);
+	if (p_send_instance != nullptr)
+	{
+		// The capabilities are advertised anew below
+		NDIlib_send_clear_connection_metadata(p_send_instance);
+	}
+	else
+	{
+		// Create valid settings to be seen on the network
+		NDIlib_send_create_t settings;
+		settings.clock_audio = false;
+		settings.clock_video = false;
+		// Beware of the limited lifetime of TCHAR_TO_UTF8 values
+		std::string SourceNameStr(TCHAR_TO_UTF8(*this->SourceName));
+		settings.p_ndi_name = SourceNameStr.c_str();
+
+		// create the instance and store it
+		p_send_instance = NDIlib_send_create(&settings);
+	}
 
 	if (p_send_instance != nullptr)
 	{
@@ -431,36 +457,66 @@ void UNDIMediaSender::ChangeBroadcastConfiguration(const FNDIBroadcastConfigurat
 */
 void UNDIMediaSender::TrySendAudioFrame(int64 time_code, float* AudioData, int32 NumSamples, int32 NumChannels, const int32 SampleRate, double AudioClock)
 {
-	if (bEnableAudio && (p_send_instance != nullptr) && (!bIsChangingBroadcastSize))
+	if (bEnableAudio && (p_send_instance != nullptr) && bIsChangingBroadcastSize)
+	{
+		FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+		++PerformanceData.AudioFramesSkippedChangingBroadcastSize;
+	}
+	else if (bEnableAudio && (p_send_instance != nullptr))
 	{
 		FScopeTryLock Lock(&AudioSyncContext);
 		// Ignore audio while changes are being made; 
-		if (Lock.IsLocked())
+		if (!Lock.IsLocked())
 		{
-			if (NDIlib_send_get_no_connections(p_send_instance, 0) > 0)
-			{
-				// Convert from the interleaved audio that Unreal Engine produces
+			FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+			++PerformanceData.AudioFramesSkippedBusy;
+		}
+		else if (NDIlib_send_get_no_connections(p_send_instance, 0) <= 0)
+		{
+			FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+			++PerformanceData.AudioFramesSkippedNoConnections;
+		}
+		else
+		{
+			const uint64 ConvertStartCycles = FPlatformTime::Cycles64();
+
+			// Convert from the interleaved audio that Unreal Engine produces
+
+			NDIlib_audio_frame_interleaved_32f_t NDI_interleaved_audio_frame;
+			NDI_interleaved_audio_frame.timecode = time_code;
+			NDI_interleaved_audio_frame.sample_rate = SampleRate;
+			NDI_interleaved_audio_frame.no_channels = NumChannels;
+			NDI_interleaved_audio_frame.no_samples = NumSamples / NumChannels;
+			NDI_interleaved_audio_frame.p_data = AudioData;
 
-				NDIlib_audio_frame_interleaved_32f_t NDI_interleaved_audio_frame;
-				NDI_interleaved_audio_frame.timecode = time_code;
-				NDI_interleaved_audio_frame.sample_rate = SampleRate;
-				NDI_interleaved_audio_frame.no_channels = NumChannels;
-				NDI_interleaved_audio_frame.no_samples = NumSamples / NumChannels;
-				NDI_interleaved_audio_frame.p_data = AudioData;
+			NDIlib_audio_frame_v2_t NDI_audio_frame;
+			SendAudioData.Reset(NumSamples);
+			NDI_audio_frame.p_data = SendAudioData.GetData();
+			NDI_audio_frame.channel_stride_in_bytes = (NumSamples / NumChannels) * sizeof(float);
 
-				NDIlib_audio_frame_v2_t NDI_audio_frame;
-				SendAudioData.Reset(NumSamples);
-				NDI_audio_frame.p_data = SendAudioData.GetData();
-				NDI_audio_frame.channel_stride_in_bytes = (NumSamples / NumChannels) * sizeof(float);
+			NDIlib_util_audio_from_interleaved_32f_v2(&NDI_interleaved_audio_frame, &NDI_audio_frame);
 
-				NDIlib_util_audio_from_interleaved_32f_v2(&NDI_interleaved_audio_frame, &NDI_audio_frame);
+			const uint64 ConvertCycles = FPlatformTime::Cycles64() - ConvertStartCycles;
 
+			OnSenderAudioPreSend.Broadcast(this);
 
-				OnSenderAudioPreSend.Broadcast(this);
+			const uint64 SendStartCycles = FPlatformTime::Cycles64();
+			NDIlib_send_send_audio_v2(p_send_instance, &NDI_audio_frame);
+			const uint64 SendCycles = FPlatformTime::Cycles64() - SendStartCycles;
 
-				NDIlib_send_send_audio_v2(p_send_instance, &NDI_audio_frame);
+			{
+				FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+				++PerformanceData.AudioFrames;
+				PerformanceData.AudioConvertTime.Add(CyclesToMicroseconds(ConvertCycles));
+				PerformanceData.AudioSendTime.Add(CyclesToMicroseconds(SendCycles));
+			}
 
-				OnSenderAudioSent.Broadcast(this);
+			if (OnSenderAudioSent.IsBound())
+			{
+				FNDIEventDispatcher::Enqueue(this, [this]()
+				{
+					OnSenderAudioSent.Broadcast(this);
+				});
 			}
 		}
 	}
@@ -475,25 +531,45 @@ void UNDIMediaSender::TrySendVideoFrame(int64 time_code)
 	// This function is called on the Engine's Main Rendering Thread. Be very careful when doing stuff here.
 	// Make sure things are done quick and efficient.
 
-	if (p_send_instance != nullptr && !bIsChangingBroadcastSize)
+	// Shutdown clears the sender from the game thread, and hands it off after this on the render thread
+	const NDIlib_send_instance_t send_instance = p_send_instance;
+
+	if (send_instance != nullptr && bIsChangingBroadcastSize)
+	{
+		FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+		++PerformanceData.VideoFramesSkippedChangingBroadcastSize;
+	}
+	else if (send_instance != nullptr)
 	{
 		FScopeLock Lock(&RenderSyncContext);
 
 		while(GetMetadataFrame())
 			; // Potential improvement: limit how much metadata is processed, to avoid appearing to lock up due to a metadata flood
 
-		if (GetRenderTargetResource() != nullptr)
+		if (GetRenderTargetResource() == nullptr)
+		{
+			FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+			++PerformanceData.VideoFramesSkippedNoRenderTarget;
+		}
+		else
 		{
 			// Alright time to perform the magic :D
-			if (NDIlib_send_get_no_connections(p_send_instance, 0) > 0)
+			if (NDIlib_send_get_no_connections(send_instance, 0) <= 0)
+			{
+				FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+				++PerformanceData.VideoFramesSkippedNoConnections;
+			}
+			else
 			{
-				FTimecode RenderTimecode =
-					FTimecode::FromTimespan(FTimespan::FromSeconds(time_code / (float)1e+7), FrameRate,
-											FTimecode::IsDropFormatTimecodeSupported(FrameRate),
-											true // use roll-over timecode
-					);
+				TimecodeConverter.SetFrameRate(FrameRate);
+				const FTimecode RenderTimecode = TimecodeConverter.FromTicks(time_code);
 
-				if (RenderTimecode.Frames != LastRenderTime.Frames)
+				if (RenderTimecode.Frames == LastRenderTime.Frames)
+				{
+					FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+					++PerformanceData.VideoFramesSkippedSameTimecode;
+				}
+				else
 				{
 					// Get the command list interface
 					FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
@@ -502,12 +578,23 @@ void UNDIMediaSender::TrySendVideoFrame(int64 time_code)
 					NDI_video_frame.timecode = time_code;
 
 					// performing color conversion if necessary and copy pixels into the data buffer for sending
-					if (DrawRenderTarget(RHICmdList))
+					const uint64 DrawStartCycles = FPlatformTime::Cycles64();
+					LastResolveCycles = 0;
+					if (!DrawRenderTarget(RHICmdList))
+					{
+						FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+						++PerformanceData.VideoFramesSkippedNoRenderTarget;
+					}
+					else
 					{
+						const uint64 DrawCycles = FPlatformTime::Cycles64() - DrawStartCycles - LastResolveCycles;
+
 						int32 Width = 0, Height = 0, LineStride = 0;
 
 						// Map the staging surface so we can copy the buffer for the NDI SDK to use
+						const uint64 MapStartCycles = FPlatformTime::Cycles64();
 						ReadbackTextures.Map(RHICmdList, Width, Height, LineStride);
+						const uint64 MapCycles = FPlatformTime::Cycles64() - MapStartCycles;
 						// Width and height are the size of the readback texture, and not the framesize represented
 						// Readback texture is used in 4:2:2 format, so actual width in pixels is double
 						Width *= 2;
@@ -521,7 +608,12 @@ void UNDIMediaSender::TrySendVideoFrame(int64 time_code)
 						if (FrameSize != FIntPoint(Width, Height))
 						{
 							// send an empty frame over NDI to be able to cleanup the buffers
-							ReadbackTextures.Flush(RHICmdList, p_send_instance);
+							ReadbackTextures.Flush(RHICmdList, send_instance);
+
+							{
+								FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+								++PerformanceData.VideoFramesSkippedChangingBroadcastSize;
+							}
 
 							// Do not hold the lock when going into ChangeRenderTargetConfiguration()
 							Lock.Unlock();
@@ -534,12 +626,31 @@ void UNDIMediaSender::TrySendVideoFrame(int64 time_code)
 							OnSenderVideoPreSend.Broadcast(this);
 
 							// send the frame over NDI
-							ReadbackTextures.Send(RHICmdList, p_send_instance, NDI_video_frame);
+							const uint64 SendStartCycles = FPlatformTime::Cycles64();
+							ReadbackTextures.Send(RHICmdList, send_instance, NDI_video_frame);
+							const uint64 SendCycles = FPlatformTime::Cycles64() - SendStartCycles;
+
+							{
+								FScopeLock PerformanceLock(&PerformanceDataSyncContext);
+								++PerformanceData.VideoFrames;
+								PerformanceData.DrawTime.Add(CyclesToMicroseconds(DrawCycles));
+								PerformanceData.ResolveTime.Add(CyclesToMicroseconds(LastResolveCycles));
+								PerformanceData.MapTime.Add(CyclesToMicroseconds(MapCycles));
+								PerformanceData.VideoSendTime.Add(CyclesToMicroseconds(SendCycles));
+							}
 
 							// Update the Last Render Time to the current Render Timecode
 							LastRenderTime = RenderTimecode;
 
-							OnSenderVideoSent.Broadcast(this);
+							// The 'Pre Send' events have to run before the frame goes out, but the others can wait for the
+							// game thread
+							if (OnSenderVideoSent.IsBound())
+							{
+								FNDIEventDispatcher::Enqueue(this, [this]()
+								{
+									OnSenderVideoSent.Broadcast(this);
+								});
+							}
 						}
 					}
 				}
@@ -548,6 +659,24 @@ void UNDIMediaSender::TrySendVideoFrame(int64 time_code)
 	}
 }
 
+/**
+	Returns the current performance data of the sender
+*/
+FNDISenderPerformanceData UNDIMediaSender::GetPerformanceData() const
+{
+	FScopeLock Lock(&PerformanceDataSyncContext);
+	return this->PerformanceData;
+}
+
+/**
+	Resets the performance data of the sender
+*/
+void UNDIMediaSender::ResetPerformanceData()
+{
+	FScopeLock Lock(&PerformanceDataSyncContext);
+	this->PerformanceData.Reset();
+}
+
 /**
 	Perform the color conversion (if any) and bit copy from the gpu
 */
@@ -765,10 +894,14 @@ bool UNDIMediaSender::DrawRenderTarget(FRHICommandListImmediate& RHICmdList)
 			// Copy to resolve target...
 			// This is by far the most expensive in terms of cost, since we are having to pull
 			// data from the gpu, while in the render thread.
+			// The flush is where the render thread waits for the commands to be handed to the GPU, so it is
+			// counted with the resolve rather than left out of every span
+			const uint64 ResolveStartCycles = FPlatformTime::Cycles64();
 			ReadbackTextures.Resolve(RHICmdList, TargetableTexture, FResolveRect(0, 0, FrameSize.X/2,FrameSize.Y), FResolveRect(0, 0, FrameSize.X/2,FrameSize.Y));
 
 			// Force all the drawing to be done here and now
 			RHICmdList.ImmediateFlush(EImmediateFlushType::FlushRHIThreadFlushResources);
+			LastResolveCycles = FPlatformTime::Cycles64() - ResolveStartCycles;
 		}
 	}
 
@@ -846,10 +979,11 @@ void UNDIMediaSender::SendMetadataFrame(const FString& Data, bool AttachToVideoF
 			OnSenderMetaDataPreSend.Broadcast(this);
 
 			// Send the metadata separate from the video frame
+			FTCHARToUTF8 DataStr(*Data);
+
 			NDIlib_metadata_frame_t metadata;
-			std::string DataStr(TCHAR_TO_UTF8(*Data));
-			metadata.p_data = const_cast<char*>(DataStr.c_str());
-			metadata.length = DataStr.length();
+			metadata.p_data = const_cast<char*>(DataStr.Get());
+			metadata.length = DataStr.Length();
 			metadata.timecode = FDateTime::Now().GetTimeOfDay().GetTicks();
 
 			NDIlib_send_send_metadata(p_send_instance, &metadata);
@@ -861,12 +995,14 @@ void UNDIMediaSender::SendMetadataFrame(const FString& Data, bool AttachToVideoF
 
 /**
 	This will send a metadata frame to all receivers
-	The data will be formatted as: <Element AttributeData/>
+	The data will be formatted as: <Element>ElementData</Element>
 */
 void UNDIMediaSender::SendMetadataFrameAttr(const FString& Element, const FString& ElementData, bool AttachToVideoFrame)
 {
-	FString Data = "<" + Element + ">" + ElementData + "</" + Element + ">";
-	SendMetadataFrame(Data, AttachToVideoFrame);
+	FNDIMetadataWriter Metadata;
+	Metadata.OpenElement(Element).Raw(ElementData).CloseElement();
+
+	SendMetadataFrameUtf8(Metadata, AttachToVideoFrame);
 }
 
 /**
@@ -875,22 +1011,79 @@ void UNDIMediaSender::SendMetadataFrameAttr(const FString& Element, const FStrin
 */
 void UNDIMediaSender::SendMetadataFrameAttrs(const FString& Element, const TMap<FString,FString>& Attributes, bool AttachToVideoFrame)
 {
-	FString Data = "<" + Element;
-	
+	FNDIMetadataWriter Metadata;
+	Metadata.OpenElement(Element);
+
 	for(const auto& Attribute : Attributes)
 	{
-		Data += " " + Attribute.Key + "=\"" + Attribute.Value + "\"";
+		FTCHARToUTF8 Key(*Attribute.Key);
+		Metadata.Attribute(FAnsiStringView(Key.Get(), Key.Length()), Attribute.Value);
+	}
+
+	Metadata.CloseElement();
+
+	SendMetadataFrameUtf8(Metadata, AttachToVideoFrame);
+}
+
+/**
+	This will send the metadata built by the writer to all receivers, without converting it
+*/
+void UNDIMediaSender::SendMetadataFrameUtf8(const FNDIMetadataWriter& Metadata, bool AttachToVideoFrame)
+{
+	if ((p_send_instance != nullptr) && !Metadata.IsEmpty())
+	{
+		if(AttachToVideoFrame == true)
+		{
+			// Attach the metadata to the next video frame to be sent
+			FScopeLock RenderLock(&RenderSyncContext);
+			this->ReadbackTextures.AddMetaData(Metadata.GetData(), Metadata.Len());
+		}
+		else
+		{
+			OnSenderMetaDataPreSend.Broadcast(this);
+
+			// Send the metadata separate from the video frame, straight from the writer's buffer
+			NDIlib_metadata_frame_t metadata;
+			metadata.p_data = const_cast<char*>(Metadata.GetData());
+			metadata.length = Metadata.Len();
+			metadata.timecode = FDateTime::Now().GetTimeOfDay().GetTicks();
+
+			NDIlib_send_send_metadata(p_send_instance, &metadata);
+
+			OnSenderMetaDataSent.Broadcast(this);
+		}
 	}
+}
+
+
+/**
+	This will send the payload to all receivers as the next frame of a channel of binary metadata
+*/
+void UNDIMediaSender::SendBinaryMetadata(FName Channel, uint16 PayloadVersion, TArrayView<const uint8> Payload, bool AttachToVideoFrame)
+{
+	if (p_send_instance != nullptr)
+	{
+		FScopeLock Lock(&BinaryMetadataSyncContext);
 
-	Data += "/>";
+		FNDIBinaryMetadataEncoder* Encoder = BinaryMetadataEncoders.Find(Channel);
+		if (Encoder == nullptr)
+			Encoder = &BinaryMetadataEncoders.Add(Channel, FNDIBinaryMetadataEncoder(Channel));
 
-	SendMetadataFrame(Data, AttachToVideoFrame);
+		// Frames attached to the video are lost when the receiver's frame-sync skips a video frame, or when the
+		// readback they are attached to is dropped, so they are all sent as key frames
+		Encoder->SetDeltaEncoding(bDeltaEncodeBinaryMetaData && !AttachToVideoFrame, BinaryMetaDataKeyFrameInterval);
+
+		BinaryMetadata.Reset();
+		Encoder->Encode(PayloadVersion, Payload, BinaryMetadata);
+
+		SendMetadataFrameUtf8(BinaryMetadata, AttachToVideoFrame);
+	}
 }
 
 
 /**
 	Attempts to get a metadata frame from the sender.
-	If there is one, the data is broadcast through OnSenderMetaDataReceived.
+	If there is one, the data is broadcast through OnNDISenderMetadataCaptureEvent and OnSenderMetaDataReceived.
 	Returns true if metadata was received, false otherwise.
 */
 bool UNDIMediaSender::GetMetadataFrame()
@@ -904,8 +1097,20 @@ bool UNDIMediaSender::GetMetadataFrame()
 		{
 			if ((metadata.p_data != nullptr) && (metadata.length > 0))
 			{
-				FString Data(UTF8_TO_TCHAR(metadata.p_data));
-				OnSenderMetaDataReceived.Broadcast(this, Data);
+				// Events are delivered on the game thread, with the next batch. The data is kept as UTF-8, so that
+				// native listeners can parse it in place; it is only converted for Blueprint listeners.
+				if (OnNDISenderMetadataCaptureEvent.IsBound() || OnSenderMetaDataReceived.IsBound())
+				{
+					TArray<ANSICHAR> Data(metadata.p_data, FCStringAnsi::Strlen(metadata.p_data) + 1);
+
+					FNDIEventDispatcher::EnqueueCoalesced(this, bLatestMetaDataOnly ? SenderMetaDataReceivedEventKey : 0, [this, Data = MoveTemp(Data)]()
+					{
+						OnNDISenderMetadataCaptureEvent.Broadcast(this, Data.GetData(), Data.Num() - 1);
+
+						if (OnSenderMetaDataReceived.IsBound())
+							OnSenderMetaDataReceived.Broadcast(this, FString(UTF8_TO_TCHAR(Data.GetData())));
+					});
+				}
 			}
 			NDIlib_send_free_metadata(p_send_instance, &metadata);
 
@@ -999,21 +1204,52 @@ void UNDIMediaSender::Shutdown()
 		FNDIConnectionService::RemoveAudioSender(this);
 	}
 
-	// Perform cleanup on the renderer related materials
+	// Stop the game and audio threads from using the sender, the render thread picks it up below
+	const NDIlib_send_instance_t RetiredSendInstance = p_send_instance.exchange(nullptr);
+
+	// Perform cleanup on the renderer related materials on the render thread, which holds the render lock for as
+	// long as it draws, maps and flushes the readback textures
+	ENQUEUE_RENDER_COMMAND(NDIMediaSender_ShutdownRT)([this, RetiredSendInstance, RetiredSourceName = this->SourceName](FRHICommandListImmediate& RHICmdList)
 	{
 		FScopeLock RenderLock(&RenderSyncContext);
 
 		// destroy the sender
-		if (p_send_instance != nullptr)
+		if (RetiredSendInstance != nullptr)
 		{
-			// Get the command list interface
-			FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
+			// Hand the sender and the readback textures it may still be sending from to the pool or the reaper,
+			// as flushing the frames in flight can take a while
+			TSharedRef<MappedTextureASyncSender, ESPMode::ThreadSafe> RetiredReadbackTextures = MakeShared<MappedTextureASyncSender, ESPMode::ThreadSafe>();
+			this->ReadbackTextures.MoveTo(*RetiredReadbackTextures);
+
+			auto FlushReadbackTextures = [RetiredReadbackTextures](NDIlib_send_instance_t InSendInstance)
+			{
+				// send an empty frame over NDI to be able to cleanup the buffers
+				NDIlib_send_send_video_async_v2(InSendInstance, nullptr);
 
-			// send an empty frame over NDI to be able to cleanup the buffers
-			this->ReadbackTextures.Flush(RHICmdList, p_send_instance);
+				// Nothing is reading from the textures anymore, so they can be released
+				ENQUEUE_RENDER_COMMAND(NDIMediaSender_ReleaseReadbackTexturesRT)([RetiredReadbackTextures](FRHICommandListImmediate& RHICmdList)
+				{
+					RetiredReadbackTextures->Unmap(RHICmdList);
+					RetiredReadbackTextures->Destroy();
+				});
+			};
+
+			// Keep the source on the network for a sender by the same name to take over, repeating the last frame
+			const bool bIsParked = FNDIMediaSenderPool::Park(RetiredSourceName, RetiredSendInstance, NDI_video_frame,
+				[RetiredReadbackTextures, FlushReadbackTextures, LineStride = NDI_video_frame.line_stride_in_bytes](NDIlib_send_instance_t InSendInstance, TArray<uint8>& OutHoldingFrameData)
+			{
+				RetiredReadbackTextures->CopyLastSentFrame(LineStride, OutHoldingFrameData);
+				FlushReadbackTextures(InSendInstance);
+			});
 
-			NDIlib_send_destroy(p_send_instance);
-			p_send_instance = nullptr;
+			if (!bIsParked)
+			{
+				FNDIMediaReaper::Retire([RetiredSendInstance, FlushReadbackTextures]()
+				{
+					FlushReadbackTextures(RetiredSendInstance);
+					NDIlib_send_destroy(RetiredSendInstance);
+				});
+			}
 		}
 
 		this->DefaultVideoTextureRHI.SafeRelease();
@@ -1021,7 +1257,9 @@ void UNDIMediaSender::Shutdown()
 		this->ReadbackTextures.Destroy();
 
 		this->RenderTargetDescriptor.Reset();
-	}
+	});
+
+	ShutdownFence.BeginFence();
 }
 
 /**
@@ -1037,6 +1275,15 @@ void UNDIMediaSender::BeginDestroy()
 	Super::BeginDestroy();
 }
 
+/**
+	Called to check if the object is ready for FinishDestroy.  The sender is ready once the render thread
+	has released its renderer related materials
+*/
+bool UNDIMediaSender::IsReadyForFinishDestroy()
+{
+	return Super::IsReadyForFinishDestroy() && ShutdownFence.IsFenceComplete();
+}
+
 /**
 	Set whether or not a Linear to sRGB conversion is made
 */
@@ -1206,6 +1453,14 @@ void* UNDIMediaSender::MappedTexture::MappedData() const
 	return pData;
 }
 
+/**
+	Returns whether the readback texture is currently mapped.
+*/
+bool UNDIMediaSender::MappedTexture::IsMapped() const
+{
+	return pData != nullptr;
+}
+
 /**
 	Unmap the readback texture (if currently mapped).
 */
@@ -1225,13 +1480,40 @@ void UNDIMediaSender::MappedTexture::Unmap(FRHICommandListImmediate& RHICmdList)
 }
 
 
+/**
+	Moves the readback texture, mapped or not, to another MappedTexture which has not been created.
+	This MappedTexture keeps its frame size, and creates a new texture when next resolved.
+*/
+void UNDIMediaSender::MappedTexture::MoveTo(MappedTexture& Other)
+{
+	check(Other.Texture.IsValid() == false);
+	check(Other.pData == nullptr);
+
+	Other.Texture = MoveTemp(Texture);
+	Other.pData = pData;
+	Other.MetaData = MoveTemp(MetaData);
+	Other.FrameSize = FrameSize;
+
+	Texture = nullptr;
+	pData = nullptr;
+	MetaData.clear();
+}
+
 /**
 	Adds metadata to the texture
 */
 void UNDIMediaSender::MappedTexture::AddMetaData(const FString& Data)
 {
-	std::string DataStr(TCHAR_TO_UTF8(*Data));
-	MetaData += DataStr;
+	FTCHARToUTF8 DataStr(*Data);
+	AddMetaData(DataStr.Get(), DataStr.Length());
+}
+
+/**
+	Adds UTF-8 metadata to the texture. The metadata keeps its capacity from frame to frame.
+*/
+void UNDIMediaSender::MappedTexture::AddMetaData(const ANSICHAR* Data, int32 Length)
+{
+	MetaData.append(Data, Length);
 }
 
 /**
@@ -1367,6 +1649,41 @@ void UNDIMediaSender::MappedTextureASyncSender::Flush(FRHICommandListImmediate&
 	CurrentIndex = 1 - CurrentIndex;
 }
 
+/**
+	Unmaps the textures (if mapped), without flushing the NDI video stream. Nothing must be reading from them anymore
+*/
+void UNDIMediaSender::MappedTextureASyncSender::Unmap(FRHICommandListImmediate& RHICmdList)
+{
+	MappedTextures[0].Unmap(RHICmdList);
+	MappedTextures[1].Unmap(RHICmdList);
+}
+
+/**
+	Copies the content of the texture which was sent last, if it is still mapped. 'LineStride' is the stride it was sent with
+*/
+void UNDIMediaSender::MappedTextureASyncSender::CopyLastSentFrame(int32 LineStride, TArray<uint8>& OutData) const
+{
+	const MappedTexture& PreviousMappedTexture = MappedTextures[1-CurrentIndex];
+
+	OutData.Reset();
+	if (PreviousMappedTexture.IsMapped() && (LineStride > 0))
+	{
+		const uint8* Data = static_cast<const uint8*>(PreviousMappedTexture.MappedData());
+		OutData.Append(Data, LineStride * PreviousMappedTexture.GetSizeXY().Y);
+	}
+}
+
+/**
+	Moves the textures, mapped or not, to another mapped texture sender which has not been created.
+	This sender keeps its frame size, and creates new textures when next used.
+*/
+void UNDIMediaSender::MappedTextureASyncSender::MoveTo(MappedTextureASyncSender& Other)
+{
+	MappedTextures[0].MoveTo(Other.MappedTextures[0]);
+	MappedTextures[1].MoveTo(Other.MappedTextures[1]);
+	Other.CurrentIndex = CurrentIndex;
+}
+
 /**
 	Adds metadata to the current texture
 */
@@ -1375,3 +1692,9 @@ void UNDIMediaSender::MappedTextureASyncSender::AddMetaData(const FString& Data)
 	MappedTexture& CurrentMappedTexture = MappedTextures[CurrentIndex];
 	CurrentMappedTexture.AddMetaData(Data);
 }
+
+void UNDIMediaSender::MappedTextureASyncSender::AddMetaData(const ANSICHAR* Data, int32 Length)
+{
+	MappedTexture& CurrentMappedTexture = MappedTextures[CurrentIndex];
+	CurrentMappedTexture.AddMetaData(Data, Length);
+}
@@ -0,0 +1,296 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include "NDIMediaSenderPool.h"
+#include "NDIMediaReaper.h"
+
+#include <Engine/World.h>
+#include <HAL/PlatformProcess.h>
+#include <HAL/PlatformTime.h>
+#include <NDIIOPluginSettings.h>
+#include <UObject/UObjectGlobals.h>
+
+
+/** The pool, created when the first sender is parked and destroyed on module shutdown */
+static FNDIMediaSenderPool* NDI_SENDER_POOL = nullptr;
+static FCriticalSection NDI_SENDER_POOL_SYNC_CONTEXT;
+static bool bIsNDISenderPoolShutdown = false;
+
+/** Set from leaving a level until the next one has loaded, only senders destroyed in that time are parked */
+static std::atomic<bool> bIsNDILevelTravelInProgress { false };
+static FDelegateHandle PreLoadMapHandle;
+static FDelegateHandle SeamlessTravelStartHandle;
+static FDelegateHandle PostLoadMapHandle;
+
+
+FNDIMediaSenderPool::FNDIMediaSenderPool()
+{
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	p_RunnableThread = FRunnableThread::Create(this, TEXT("FNDIMediaSenderPool"), 0, TPri_BelowNormal);
+}
+
+FNDIMediaSenderPool::~FNDIMediaSenderPool()
+{
+	if (p_RunnableThread != nullptr)
+	{
+		p_RunnableThread->Kill(true);
+		delete p_RunnableThread;
+		p_RunnableThread = nullptr;
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+}
+
+bool FNDIMediaSenderPool::Park(const FString& InSourceName, NDIlib_send_instance_t InSendInstance, const NDIlib_video_frame_v2_t& InHoldingFrame, FDetachFunction&& InDetach)
+{
+	const UNDIIOPluginSettings* CoreSettings = GetDefault<UNDIIOPluginSettings>();
+	if (!CoreSettings->bKeepSendersAcrossLevelTravel || (CoreSettings->SenderHoldTime <= 0.f) || InSourceName.IsEmpty())
+		return false;
+
+	// A sender which is destroyed for any other reason takes its source with it
+	if (!bIsNDILevelTravelInProgress)
+		return false;
+
+	FParkedSenderRef Sender = MakeShared<FParkedSender, ESPMode::ThreadSafe>();
+	Sender->p_send_instance = InSendInstance;
+	Sender->Detach = MoveTemp(InDetach);
+	Sender->HoldingFrame = InHoldingFrame;
+	Sender->HoldingFrame.p_data = nullptr;
+	Sender->HoldingFrame.p_metadata = nullptr;
+	Sender->NextFrameTime = FPlatformTime::Seconds();
+	Sender->ExpiryTime = Sender->NextFrameTime + CoreSettings->SenderHoldTime;
+
+	TSharedPtr<FParkedSender, ESPMode::ThreadSafe> ExistingSender;
+	{
+		FScopeLock Lock(&NDI_SENDER_POOL_SYNC_CONTEXT);
+
+		if (bIsNDISenderPoolShutdown)
+			return false;
+
+		if (NDI_SENDER_POOL == nullptr)
+			NDI_SENDER_POOL = new FNDIMediaSenderPool();
+
+		// Only one source can go by a name; a sender which was parked under it before is done with
+		if (FParkedSenderRef* Existing = NDI_SENDER_POOL->ParkedSenders.Find(InSourceName))
+			ExistingSender = *Existing;
+		NDI_SENDER_POOL->ParkedSenders.Add(InSourceName, Sender);
+
+		NDI_SENDER_POOL->WakeEvent->Trigger();
+	}
+
+	if (ExistingSender.IsValid())
+	{
+		FScopeLock SenderLock(&ExistingSender->SyncContext);
+		ReleaseSender(*ExistingSender);
+	}
+
+	return true;
+}
+
+NDIlib_send_instance_t FNDIMediaSenderPool::Claim(const FString& InSourceName)
+{
+	TSharedPtr<FParkedSender, ESPMode::ThreadSafe> Sender;
+	{
+		FScopeLock Lock(&NDI_SENDER_POOL_SYNC_CONTEXT);
+
+		if (NDI_SENDER_POOL == nullptr)
+			return nullptr;
+
+		if (FParkedSenderRef* Parked = NDI_SENDER_POOL->ParkedSenders.Find(InSourceName))
+		{
+			Sender = *Parked;
+			NDI_SENDER_POOL->ParkedSenders.Remove(InSourceName);
+		}
+	}
+
+	if (!Sender.IsValid())
+		return nullptr;
+
+	// Claimed straight after being parked; the previous owner still has to let go of it.  This only waits on
+	// the holding frame being sent on this sender, the pool carries on with the others meanwhile
+	FScopeLock SenderLock(&Sender->SyncContext);
+
+	DetachSender(*Sender);
+
+	NDIlib_send_instance_t SendInstance = Sender->p_send_instance;
+	Sender->p_send_instance = nullptr;
+
+	return SendInstance;
+}
+
+void FNDIMediaSenderPool::Startup()
+{
+	check(IsInGameThread());
+
+	// Senders destroyed between leaving one level and having loaded the next are parked.  Seamless travel
+	// broadcasts the end of loading the map as well
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddLambda([](const FString&)
+	{
+		bIsNDILevelTravelInProgress = true;
+	});
+	SeamlessTravelStartHandle = FWorldDelegates::OnSeamlessTravelStart.AddLambda([](UWorld*, const FString&)
+	{
+		bIsNDILevelTravelInProgress = true;
+	});
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddLambda([](UWorld*)
+	{
+		bIsNDILevelTravelInProgress = false;
+	});
+}
+
+void FNDIMediaSenderPool::Shutdown()
+{
+	check(IsInGameThread());
+
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+	FWorldDelegates::OnSeamlessTravelStart.Remove(SeamlessTravelStartHandle);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	bIsNDILevelTravelInProgress = false;
+
+	FNDIMediaSenderPool* Pool = nullptr;
+	{
+		FScopeLock Lock(&NDI_SENDER_POOL_SYNC_CONTEXT);
+
+		bIsNDISenderPoolShutdown = true;
+		Pool = NDI_SENDER_POOL;
+		NDI_SENDER_POOL = nullptr;
+	}
+
+	if (Pool != nullptr)
+	{
+		// The thread is stopped first, so nothing is sending on the instances while they are released
+		Pool->Stop();
+		delete Pool;
+	}
+}
+
+/** FRunnable Interface implementation for 'Run' */
+uint32 FNDIMediaSenderPool::Run()
+{
+	while (bIsThreadRunning)
+	{
+		const double WaitTime = Update(FPlatformTime::Seconds());
+
+		WakeEvent->Wait(FMath::Clamp(static_cast<uint32>(WaitTime * 1000.0), 1u, 1000u));
+	}
+
+	TMap<FString, FParkedSenderRef> RemainingSenders;
+	{
+		FScopeLock Lock(&NDI_SENDER_POOL_SYNC_CONTEXT);
+		RemainingSenders = MoveTemp(ParkedSenders);
+	}
+
+	for (auto& ParkedSender : RemainingSenders)
+	{
+		FScopeLock SenderLock(&ParkedSender.Value->SyncContext);
+		ReleaseSender(*ParkedSender.Value);
+	}
+
+	return 0;
+}
+
+/** FRunnable Interface implementation for 'Stop' */
+void FNDIMediaSenderPool::Stop()
+{
+	bIsThreadRunning = false;
+	WakeEvent->Trigger();
+}
+
+double FNDIMediaSenderPool::Update(double Now)
+{
+	TArray<FParkedSenderRef> Senders;
+	TArray<FParkedSenderRef> ExpiredSenders;
+	{
+		FScopeLock Lock(&NDI_SENDER_POOL_SYNC_CONTEXT);
+
+		for (auto It = ParkedSenders.CreateIterator(); It; ++It)
+		{
+			// Nothing took the source over in time
+			if (Now >= It.Value()->ExpiryTime)
+			{
+				ExpiredSenders.Add(It.Value());
+				It.RemoveCurrent();
+			}
+			else
+				Senders.Add(It.Value());
+		}
+	}
+
+	for (const FParkedSenderRef& Sender : ExpiredSenders)
+	{
+		FScopeLock SenderLock(&Sender->SyncContext);
+		ReleaseSender(*Sender);
+	}
+
+	double WaitTime = 1.0;
+
+	for (const FParkedSenderRef& Sender : Senders)
+		WaitTime = FMath::Min(WaitTime, UpdateSender(*Sender, Now));
+
+	return FMath::Max(WaitTime, 0.0);
+}
+
+double FNDIMediaSenderPool::UpdateSender(FParkedSender& Sender, double Now)
+{
+	FScopeLock SenderLock(&Sender.SyncContext);
+
+	// Claimed since the pool was looked at
+	if (Sender.p_send_instance == nullptr)
+		return 1.0;
+
+	DetachSender(Sender);
+
+	double WaitTime = Sender.ExpiryTime - Now;
+
+	if (Sender.HoldingFrame.p_data != nullptr)
+	{
+		if (Now >= Sender.NextFrameTime)
+		{
+			// Repeat the last frame at the rate it was sent at, so that receivers don't think the source has gone
+			Sender.HoldingFrame.timecode = NDIlib_send_timecode_synthesize;
+			NDIlib_send_send_video_v2(Sender.p_send_instance, &Sender.HoldingFrame);
+
+			const double FrameInterval = (Sender.HoldingFrame.frame_rate_N > 0)
+				? static_cast<double>(Sender.HoldingFrame.frame_rate_D) / Sender.HoldingFrame.frame_rate_N
+				: 1.0 / 30.0;
+			Sender.NextFrameTime = FMath::Max(Sender.NextFrameTime + FrameInterval, Now);
+		}
+
+		WaitTime = FMath::Min(WaitTime, Sender.NextFrameTime - Now);
+	}
+
+	return WaitTime;
+}
+
+void FNDIMediaSenderPool::DetachSender(FParkedSender& Sender)
+{
+	if (!Sender.Detach)
+		return;
+
+	Sender.Detach(Sender.p_send_instance, Sender.HoldingFrameData);
+	Sender.Detach = nullptr;
+
+	const int64 FrameBytes = static_cast<int64>(Sender.HoldingFrame.line_stride_in_bytes) * Sender.HoldingFrame.yres
+		* ((Sender.HoldingFrame.FourCC == NDIlib_FourCC_type_UYVA) ? 3 : 2) / 2;
+	Sender.HoldingFrame.p_data = (FrameBytes > 0) && (Sender.HoldingFrameData.Num() >= FrameBytes) ? Sender.HoldingFrameData.GetData() : nullptr;
+}
+
+void FNDIMediaSenderPool::ReleaseSender(FParkedSender& Sender)
+{
+	// Claimed already
+	if (Sender.p_send_instance == nullptr)
+		return;
+
+	DetachSender(Sender);
+
+	FNDIMediaReaper::Retire([RetiredSendInstance = Sender.p_send_instance]()
+	{
+		NDIlib_send_destroy(RetiredSendInstance);
+	});
+	Sender.p_send_instance = nullptr;
+}
@@ -0,0 +1,99 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <HAL/Runnable.h>
+#include <HAL/RunnableThread.h>
+#include <Templates/Function.h>
+
+#include <NDIIOPluginAPI.h>
+
+#include <atomic>
+
+
+/**
+	Keeps the SDK sender instances of senders destroyed by level travel alive under their source name for a while,
+	repeating the last frame each of them sent.  A sender created with the same source name in that time, such as in
+	the next level, takes the instance over, so receivers don't see the source go away.  Senders destroyed at any other
+	time are not parked, so that their source goes away with them.
+*/
+class FNDIMediaSenderPool : public FRunnable
+{
+public:
+	/**
+		Detaches a parked sender instance from its previous owner: fills 'OutHoldingFrameData' with the last frame
+		sent (if any), and waits for the frames still in flight. Run once, on the pool thread or when claimed
+	*/
+	using FDetachFunction = TUniqueFunction<void(NDIlib_send_instance_t InSendInstance, TArray<uint8>& OutHoldingFrameData)>;
+
+	/**
+		Parks a sender instance under its source name. 'InHoldingFrame' describes the frame to repeat while parked.
+		Returns false, without taking the instance, if parking is disabled, no level travel is in progress or the
+		pool has shut down
+	*/
+	static bool Park(const FString& InSourceName, NDIlib_send_instance_t InSendInstance, const NDIlib_video_frame_v2_t& InHoldingFrame, FDetachFunction&& InDetach);
+
+	/** Takes over the instance parked under the source name, or returns nullptr if there is none */
+	static NDIlib_send_instance_t Claim(const FString& InSourceName);
+
+	/** Starts following level travel. Called from the game thread on module startup */
+	static void Startup();
+
+	/** Stops the pool, and destroys the instances still parked. Called from the game thread on module shutdown */
+	static void Shutdown();
+
+private:
+	/** A parked sender; its instance is only sent on, detached or released with its sync context held */
+	struct FParkedSender
+	{
+		FCriticalSection SyncContext;
+
+		/** Cleared when the sender is claimed or released, after which the pool doesn't touch it anymore */
+		NDIlib_send_instance_t p_send_instance = nullptr;
+		FDetachFunction Detach;
+
+		NDIlib_video_frame_v2_t HoldingFrame;
+		TArray<uint8> HoldingFrameData;
+
+		double NextFrameTime = 0.0;
+		double ExpiryTime = 0.0;
+	};
+
+	FNDIMediaSenderPool();
+	virtual ~FNDIMediaSenderPool();
+
+	/** FRunnable Interface implementation for 'Run' */
+	virtual uint32 Run() override;
+
+	/** FRunnable Interface implementation for 'Stop' */
+	virtual void Stop() override;
+
+	/**
+		Sends the holding frames which are due, releases the expired senders, and returns the seconds until the next
+		is due.  The senders are sent on outside of the pool's sync context, so that claiming one doesn't wait on them
+	*/
+	double Update(double Now);
+
+	/** Sends the holding frame of a sender if it is due, and returns the seconds until the next one is */
+	static double UpdateSender(FParkedSender& Sender, double Now);
+
+	/** Both are called with the sync context of the sender held */
+	static void DetachSender(FParkedSender& Sender);
+	static void ReleaseSender(FParkedSender& Sender);
+
+private:
+	using FParkedSenderRef = TSharedRef<FParkedSender, ESPMode::ThreadSafe>;
+
+	/** The parked senders by source name, guarded by the pool's sync context */
+	TMap<FString, FParkedSenderRef> ParkedSenders;
+
+	FEvent* WakeEvent = nullptr;
+	FRunnableThread* p_RunnableThread = nullptr;
+	std::atomic<bool> bIsThreadRunning { true };
+};
@@ -27,6 +27,7 @@ void UNDIMediaTexture2D::UpdateTextureReference(FRHICommandList& RHICmdList, FTe
 		{
 			if (FNDIMediaTextureResource* TextureResource = static_cast<FNDIMediaTextureResource*>(this->GetMyResource()))
 			{
+				// Not waited for; the resource is only released by render commands queued after this one
 				ENQUEUE_RENDER_COMMAND(FNDIMediaTexture2DUpdateTextureReference)
 				([this](FRHICommandListImmediate& RHICmdList) {
 
@@ -64,9 +65,6 @@ void UNDIMediaTexture2D::UpdateTextureReference(FRHICommandList& RHICmdList, FTe
 
 					RHIUpdateTextureReference(TextureReference.TextureReferenceRHI, GetMyResource()->TextureRHI);
 				});
-
-				// Make sure _RenderThread is executed before continuing
-				FlushRenderingCommands();
 			}
 		}
 	}
@@ -0,0 +1,174 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include "NDIMediaVideoArrival.h"
+
+#include <HAL/PlatformProcess.h>
+#include <HAL/PlatformTime.h>
+
+
+FNDIMediaVideoArrival::FNDIMediaVideoArrival()
+{
+	ArrivalEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	p_RunnableThread = FRunnableThread::Create(this, TEXT("FNDIMediaVideoArrival"), 0, TPri_AboveNormal);
+}
+
+FNDIMediaVideoArrival::~FNDIMediaVideoArrival()
+{
+	if (p_RunnableThread != nullptr)
+	{
+		p_RunnableThread->Kill(true);
+		delete p_RunnableThread;
+		p_RunnableThread = nullptr;
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+	FPlatformProcess::ReturnSynchEventToPool(ArrivalEvent);
+	ArrivalEvent = nullptr;
+}
+
+void FNDIMediaVideoArrival::SetInstance(const TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe>& InInstance)
+{
+	{
+		FScopeLock Lock(&InstanceSyncContext);
+		Instance = InInstance;
+	}
+
+	// Frames of the previous connection don't count as arrivals
+	bHasFrame = false;
+	WakeEvent->Trigger();
+}
+
+bool FNDIMediaVideoArrival::GetLatest(int64 InLastTimestamp, int64& OutTimestamp, FFrameRate& OutFrameRate) const
+{
+	if (!bHasFrame.load())
+		return false;
+
+	const int64 Timestamp = LatestTimestamp.load();
+	if (Timestamp == InLastTimestamp)
+		return false;
+
+	OutTimestamp = Timestamp;
+	OutFrameRate = FFrameRate(LatestFrameRateNumerator.load(), LatestFrameRateDenominator.load());
+	return true;
+}
+
+bool FNDIMediaVideoArrival::Wait(int64 InLastTimestamp, double InTimeout, int64& OutTimestamp, FFrameRate& OutFrameRate)
+{
+	const double Deadline = FPlatformTime::Seconds() + FMath::Max(InTimeout, 0.0);
+
+	++NumWaiters;
+	WakeEvent->Trigger();
+
+	bool bArrived = false;
+	for (;;)
+	{
+		if (GetLatest(InLastTimestamp, OutTimestamp, OutFrameRate))
+		{
+			bArrived = true;
+			break;
+		}
+
+		const double Remaining = Deadline - FPlatformTime::Seconds();
+		if (Remaining <= 0.0)
+			break;
+
+		ArrivalEvent->Wait(FTimespan::FromSeconds(Remaining));
+	}
+
+	LastWaitTime = FPlatformTime::Seconds();
+	--NumWaiters;
+
+	return bArrived;
+}
+
+void FNDIMediaVideoArrival::NotifyArrival(const NDIlib_video_frame_v2_t& InFrame)
+{
+	Publish(InFrame);
+}
+
+bool FNDIMediaVideoArrival::Publish(const NDIlib_video_frame_v2_t& InFrame)
+{
+	if ((InFrame.p_data == nullptr) || (InFrame.xres <= 0) || (InFrame.yres <= 0))
+		return false;
+
+	// Fall back to the sender's timecode if the frame was not timestamped
+	const int64 Timestamp = (InFrame.timestamp != NDIlib_recv_timestamp_undefined) ? InFrame.timestamp : InFrame.timecode;
+
+	if (bHasFrame.load() && (Timestamp == LatestTimestamp.load()))
+		return false;
+
+	LatestFrameRateNumerator = InFrame.frame_rate_N;
+	LatestFrameRateDenominator = (InFrame.frame_rate_D > 0) ? InFrame.frame_rate_D : 1;
+	LatestTimestamp = Timestamp;
+	bHasFrame = true;
+
+	ArrivalEvent->Trigger();
+	return true;
+}
+
+/** FRunnable Interface implementation for 'Run' */
+uint32 FNDIMediaVideoArrival::Run()
+{
+	static const uint32 idle_wait_time = 100;
+	static const double poll_interval = 0.001;
+	static const double linger_time = 1.0;
+
+	double LastArrivalTime = 0.0;
+	double FramePeriod = 0.0;
+
+	while (bIsThreadRunning)
+	{
+		TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> WatchInstance;
+		{
+			FScopeLock Lock(&InstanceSyncContext);
+			WatchInstance = Instance;
+		}
+
+		// Nothing to watch, or nobody to tell
+		const bool bIsWaitedOn = (NumWaiters.load() > 0) || (FPlatformTime::Seconds() - LastWaitTime.load() < linger_time);
+		if (!WatchInstance.IsValid() || (WatchInstance->GetFramesyncInstance() == nullptr) || !bIsWaitedOn)
+		{
+			WakeEvent->Wait(idle_wait_time);
+			continue;
+		}
+
+		// The frame-sync can be captured from any thread; the frame is only looked at and handed straight back
+		NDIlib_video_frame_v2_t video_frame;
+		NDIlib_framesync_capture_video(WatchInstance->GetFramesyncInstance(), &video_frame, NDIlib_frame_format_type_progressive);
+
+		const double Now = FPlatformTime::Seconds();
+
+		if (Publish(video_frame))
+		{
+			LastArrivalTime = Now;
+			FramePeriod = ((video_frame.frame_rate_N > 0) && (video_frame.frame_rate_D > 0))
+						? (double)video_frame.frame_rate_D / (double)video_frame.frame_rate_N : 0.0;
+		}
+
+		NDIlib_framesync_free_video(WatchInstance->GetFramesyncInstance(), &video_frame);
+
+		// Don't look again before the next frame is due, then look finely so that its arrival is seen early
+		double NextPoll = Now + poll_interval;
+		if (FramePeriod > 0.0)
+			NextPoll = FMath::Max(NextPoll, LastArrivalTime + FramePeriod * 0.75);
+
+		WakeEvent->Wait(FTimespan::FromSeconds(NextPoll - Now));
+	}
+
+	return 0;
+}
+
+/** FRunnable Interface implementation for 'Stop' */
+void FNDIMediaVideoArrival::Stop()
+{
+	bIsThreadRunning = false;
+	WakeEvent->Trigger();
+	ArrivalEvent->Trigger();
+}
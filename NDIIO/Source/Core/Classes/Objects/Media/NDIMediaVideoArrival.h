@@ -0,0 +1,82 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <HAL/Runnable.h>
+#include <HAL/RunnableThread.h>
+#include <Misc/FrameRate.h>
+
+#include <Objects/Media/NDIMediaVideoFrame.h>
+
+#include <atomic>
+
+
+/**
+	Signals an event as new video frames of a receiver arrive, so that a thread which needs to wait for the source
+	(e.g. to genlock the engine) can block on it.  The receiver signals the frames it captures itself.  The frame-sync
+	cannot notify arrivals though, so while someone waits it is also polled on a thread of its own: at short intervals
+	once the next frame is due according to the rate of the source, and not at all before.  The poll carries on for a
+	second after the last wait, so that a wait which doesn't block at all can still see the frames which arrived since
+	the previous one.
+*/
+class FNDIMediaVideoArrival : public FRunnable
+{
+public:
+	FNDIMediaVideoArrival();
+	virtual ~FNDIMediaVideoArrival();
+
+	/** Changes the receiver to watch, or stops watching with nullptr */
+	void SetInstance(const TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe>& InInstance);
+
+	/**
+		Blocks until a frame with a timestamp other than 'InLastTimestamp' has arrived, or for at most 'InTimeout'
+		seconds.  Returns true with the timestamp and frame rate of the newest frame if one did.  Meant to be called
+		from a single thread at a time.
+	*/
+	bool Wait(int64 InLastTimestamp, double InTimeout, int64& OutTimestamp, FFrameRate& OutFrameRate);
+
+	/** Signals a frame captured by the receiver, without waiting for the poll to see it */
+	void NotifyArrival(const NDIlib_video_frame_v2_t& InFrame);
+
+private:
+	/** FRunnable Interface implementation for 'Run' */
+	virtual uint32 Run() override;
+
+	/** FRunnable Interface implementation for 'Stop' */
+	virtual void Stop() override;
+
+	bool GetLatest(int64 InLastTimestamp, int64& OutTimestamp, FFrameRate& OutFrameRate) const;
+
+	/** Publishes the frame for the waiters if it is new, returns true if it was */
+	bool Publish(const NDIlib_video_frame_v2_t& InFrame);
+
+private:
+	TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> Instance;
+	FCriticalSection InstanceSyncContext;
+
+	/** The newest frame seen, published for the waiters */
+	std::atomic<bool> bHasFrame { false };
+	std::atomic<int64> LatestTimestamp { 0 };
+	std::atomic<int32> LatestFrameRateNumerator { 0 };
+	std::atomic<int32> LatestFrameRateDenominator { 1 };
+
+	std::atomic<int32> NumWaiters { 0 };
+
+	/** When the last wait ended, the watch goes on for a while after it so that a wait which can't block sees frames */
+	std::atomic<double> LastWaitTime { 0.0 };
+
+	/** Triggered for the waiters when a frame arrives */
+	FEvent* ArrivalEvent = nullptr;
+
+	/** Triggered for the watch thread when it has something to do */
+	FEvent* WakeEvent = nullptr;
+
+	FRunnableThread* p_RunnableThread = nullptr;
+	std::atomic<bool> bIsThreadRunning { true };
+};
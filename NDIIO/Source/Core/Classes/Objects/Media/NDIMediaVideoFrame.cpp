@@ -0,0 +1,142 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Objects/Media/NDIMediaVideoFrame.h>
+#include <HAL/PlatformProcess.h>
+
+
+FNDIMediaReceiverInstance::FNDIMediaReceiverInstance(NDIlib_recv_instance_t InReceiveInstance, NDIlib_framesync_instance_t InFramesyncInstance)
+	: p_receive_instance(InReceiveInstance)
+	, p_framesync_instance(InFramesyncInstance)
+{}
+
+FNDIMediaReceiverInstance::~FNDIMediaReceiverInstance()
+{
+	Invalidate();
+}
+
+void FNDIMediaReceiverInstance::Invalidate()
+{
+	FScopeLock Lock(&InstanceSyncContext);
+
+	if (bIsInvalidated)
+		return;
+	bIsInvalidated = true;
+
+	// The frame-sync was created from the receiver, so it has to go first
+	NDIlib_framesync_instance_t framesync_instance = p_framesync_instance.exchange(nullptr);
+	if (framesync_instance != nullptr)
+		NDIlib_framesync_destroy(framesync_instance);
+
+	NDIlib_recv_instance_t receive_instance = p_receive_instance.exchange(nullptr);
+	if (receive_instance != nullptr)
+		NDIlib_recv_destroy(receive_instance);
+}
+
+void FNDIMediaReceiverInstance::FreeVideo(NDIlib_video_frame_v2_t& InFrame)
+{
+	FScopeLock Lock(&InstanceSyncContext);
+
+	// Once invalidated the buffer went away with the frame-sync, possibly along with the NDI library itself
+	if (!bIsInvalidated && (p_framesync_instance != nullptr))
+		NDIlib_framesync_free_video(p_framesync_instance, &InFrame);
+}
+
+
+FNDIMediaVideoFrame::FNDIMediaVideoFrame(const TSharedRef<FNDIMediaReceiverInstance, ESPMode::ThreadSafe>& InInstance, const NDIlib_video_frame_v2_t& InFrame)
+	: Instance(InInstance)
+	, Frame(InFrame)
+{}
+
+FNDIMediaVideoFrame::~FNDIMediaVideoFrame()
+{
+	// Hand the buffer back to the frame-sync it was captured from
+	Instance->FreeVideo(Frame);
+}
+
+
+FNDIMediaVideoFrameSubscription::FNDIMediaVideoFrameSubscription(EMode InMode, int32 InCapacity)
+	: Mode(InMode)
+	, Capacity((InMode == EMode::LatestOnly) ? 1 : FMath::Max(InCapacity, 1))
+{
+	Frames.SetNum(Capacity);
+	FrameAvailableEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FNDIMediaVideoFrameSubscription::~FNDIMediaVideoFrameSubscription()
+{
+	FPlatformProcess::ReturnSynchEventToPool(FrameAvailableEvent);
+	FrameAvailableEvent = nullptr;
+}
+
+bool FNDIMediaVideoFrameSubscription::Dequeue(FNDIMediaVideoFramePtr& OutFrame)
+{
+	FScopeLock Lock(&QueueSyncContext);
+
+	if (Count == 0)
+		return false;
+
+	OutFrame = MoveTemp(Frames[Head]);
+	Frames[Head].Reset();
+	Head = (Head + 1) % Capacity;
+	--Count;
+
+	return true;
+}
+
+bool FNDIMediaVideoFrameSubscription::WaitAndDequeue(FNDIMediaVideoFramePtr& OutFrame, uint32 WaitTimeMs)
+{
+	if (Dequeue(OutFrame))
+		return true;
+
+	FrameAvailableEvent->Wait(WaitTimeMs);
+
+	return Dequeue(OutFrame);
+}
+
+int32 FNDIMediaVideoFrameSubscription::Num() const
+{
+	FScopeLock Lock(&QueueSyncContext);
+
+	return Count;
+}
+
+int64 FNDIMediaVideoFrameSubscription::GetDroppedFrames() const
+{
+	FScopeLock Lock(&QueueSyncContext);
+
+	return DroppedFrames;
+}
+
+void FNDIMediaVideoFrameSubscription::Enqueue(const FNDIMediaVideoFrameRef& InFrame)
+{
+	// The frame being replaced is released outside of the lock
+	FNDIMediaVideoFramePtr ReleasedFrame;
+
+	{
+		FScopeLock Lock(&QueueSyncContext);
+
+		if (Count == Capacity)
+		{
+			++DroppedFrames;
+
+			if (Mode == EMode::EveryFrame)
+				return;
+
+			// Replace the frame which was never taken
+			ReleasedFrame = MoveTemp(Frames[Head]);
+			Frames[Head].Reset();
+			Head = (Head + 1) % Capacity;
+			--Count;
+		}
+
+		Frames[(Head + Count) % Capacity] = InFrame;
+		++Count;
+	}
+
+	FrameAvailableEvent->Trigger();
+}
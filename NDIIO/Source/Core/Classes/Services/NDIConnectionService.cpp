@@ -46,45 +46,8 @@ bool FNDIConnectionService::Start()
 	{
 		bIsInitialized = true;
 
-		// Define some basic properties
-		FNDIBroadcastConfiguration Configuration;
-		FString BroadcastName = TEXT("Unreal Engine");
-		EObjectFlags Flags = RF_Public | RF_Standalone | RF_Transient | RF_MarkAsNative;
-
-		bool bBeginBroadcastOnPlay = false;
-
-		// Load the plugin settings for broadcasting the active viewport
-		if (auto* CoreSettings = NewObject<UNDIIOPluginSettings>())
-		{
-			// Define the configuration properties
-			Configuration.FrameRate = CoreSettings->BroadcastRate;
-			Configuration.FrameSize = FIntPoint(FMath::Clamp(CoreSettings->PreferredFrameSize.X, 240, 3840),
-												FMath::Clamp(CoreSettings->PreferredFrameSize.Y, 240, 3840));
-
-			// Set the broadcast name
-			BroadcastName = CoreSettings->ApplicationStreamName;
-
-			bBeginBroadcastOnPlay = CoreSettings->bBeginBroadcastOnPlay;
-
-			// clean-up the settings object
-			CoreSettings->ConditionalBeginDestroy();
-			CoreSettings = nullptr;
-		}
-
-		/** Construct the Active Viewport video texture */
-		this->VideoTexture = NewObject<UTextureRenderTarget2D>(
-			GetTransientPackage(), UTextureRenderTarget2D::StaticClass(), TEXT("NDIViewportVideoTexture"), Flags);
-
-		/** Construct the active viewport sender */
-		this->ActiveViewportSender = NewObject<UNDIMediaSender>(GetTransientPackage(), UNDIMediaSender::StaticClass(),
-																TEXT("NDIViewportSender"), Flags);
-
-		VideoTexture->UpdateResource();
-
-		// Update the active viewport sender, with the properties defined in the settings configuration
-		this->ActiveViewportSender->ChangeSourceName(BroadcastName);
-		this->ActiveViewportSender->ChangeVideoTexture(VideoTexture);
-		this->ActiveViewportSender->ChangeBroadcastConfiguration(Configuration);
+		// The active viewport sender and its texture are only created once the viewport is broadcast
+		const bool bBeginBroadcastOnPlay = GetDefault<UNDIIOPluginSettings>()->bBeginBroadcastOnPlay;
 
 		// Hook into the core for the end of frame handlers
 		FCoreDelegates::OnEndFrameRT.AddRaw(this, &FNDIConnectionService::OnEndRenderFrame);
@@ -223,8 +186,35 @@ void FNDIConnectionService::OnEnginePreExit()
 	StopAudioCapture();
 }
 
+/**
+	Creates the texture and sender used to broadcast the active viewport
+*/
+void FNDIConnectionService::CreateActiveViewportSender()
+{
+	if (IsValid(this->ActiveViewportSender))
+		return;
+
+	EObjectFlags Flags = RF_Public | RF_Standalone | RF_Transient | RF_MarkAsNative;
+
+	/** Construct the Active Viewport video texture */
+	this->VideoTexture = NewObject<UTextureRenderTarget2D>(
+		GetTransientPackage(), UTextureRenderTarget2D::StaticClass(), TEXT("NDIViewportVideoTexture"), Flags);
+
+	/** Construct the active viewport sender */
+	this->ActiveViewportSender = NewObject<UNDIMediaSender>(GetTransientPackage(), UNDIMediaSender::StaticClass(),
+															TEXT("NDIViewportSender"), Flags);
+
+	VideoTexture->UpdateResource();
+
+	// The name and broadcast configuration are applied from the settings when the broadcast begins
+	this->ActiveViewportSender->ChangeVideoTexture(VideoTexture);
+}
+
 bool FNDIConnectionService::BeginBroadcastingActiveViewport()
 {
+	if (bIsInitialized && !bIsBroadcastingActiveViewport)
+		CreateActiveViewportSender();
+
 	if (!bIsBroadcastingActiveViewport && IsValid(ActiveViewportSender))
 	{
 		// Load the plugin settings for broadcasting the active viewport
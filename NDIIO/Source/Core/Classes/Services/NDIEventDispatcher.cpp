@@ -0,0 +1,85 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Services/NDIEventDispatcher.h>
+
+#include <Misc/CoreDelegates.h>
+
+/** Define Global Accessors */
+
+TQueue<FNDIEventDispatcher::FQueuedEvent, EQueueMode::Mpsc> FNDIEventDispatcher::EventQueue;
+FDelegateHandle FNDIEventDispatcher::BeginFrameHandle;
+
+/** ************************ **/
+
+void FNDIEventDispatcher::Enqueue(const UObject* Owner, TUniqueFunction<void()>&& InDispatch)
+{
+	EnqueueCoalesced(Owner, 0, MoveTemp(InDispatch));
+}
+
+void FNDIEventDispatcher::EnqueueCoalesced(const UObject* Owner, uint32 CoalesceKey, TUniqueFunction<void()>&& InDispatch)
+{
+	FQueuedEvent Event;
+	Event.Owner = Owner;
+	Event.OwnerKey = Owner;
+	Event.CoalesceKey = CoalesceKey;
+	Event.Dispatch = MoveTemp(InDispatch);
+
+	EventQueue.Enqueue(MoveTemp(Event));
+}
+
+void FNDIEventDispatcher::Start()
+{
+	check(IsInGameThread());
+
+	if (!BeginFrameHandle.IsValid())
+		BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddStatic(&FNDIEventDispatcher::DispatchEvents);
+}
+
+void FNDIEventDispatcher::Shutdown()
+{
+	check(IsInGameThread());
+
+	FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+	BeginFrameHandle.Reset();
+
+	EventQueue.Empty();
+}
+
+void FNDIEventDispatcher::DispatchEvents()
+{
+	check(IsInGameThread());
+
+	// Only the events queued so far are delivered; those queued while delivering wait for the next frame.
+	// The batch is kept between frames so that it does not allocate once it has grown
+	static TArray<FQueuedEvent> Batch;
+	static TMap<TPair<const UObject*, uint32>, int32> LatestCoalesced;
+
+	FQueuedEvent Event;
+	while (EventQueue.Dequeue(Event))
+	{
+		if (Event.CoalesceKey != 0)
+			LatestCoalesced.Add(TPair<const UObject*, uint32>(Event.OwnerKey, Event.CoalesceKey), Batch.Num());
+
+		Batch.Add(MoveTemp(Event));
+	}
+
+	for (int32 iter = 0; iter < Batch.Num(); ++iter)
+	{
+		FQueuedEvent& QueuedEvent = Batch[iter];
+
+		// Skip the events which a later one under the same key replaces
+		if ((QueuedEvent.CoalesceKey != 0) && (LatestCoalesced.FindChecked(TPair<const UObject*, uint32>(QueuedEvent.OwnerKey, QueuedEvent.CoalesceKey)) != iter))
+			continue;
+
+		if (QueuedEvent.Owner.IsValid())
+			QueuedEvent.Dispatch();
+	}
+
+	Batch.Reset();
+	LatestCoalesced.Reset();
+}
@@ -7,27 +7,63 @@
 
 #include <Services/NDIFinderService.h>
 #include <Async/Async.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
 #include <NDIIOPluginAPI.h>
+#include <NDIIOPluginSettings.h>
+
+#include <string>
 
 /** Define Global Accessors */
 
-static NDIlib_find_instance_t NDI_FIND_INSTANCE = nullptr;
 static FCriticalSection NDI_FIND_SYNC_CONTEXT;
+static FNDIFinderService* NDI_DEFAULT_FINDER_SERVICE = nullptr;
 
 FNDIFinderService::FNDISourceCollectionChangedEvent FNDIFinderService::EventOnNDISourceCollectionChanged;
 
-TArray<FNDIConnectionInformation> FNDIFinderService::NetworkSourceCollection = TArray<FNDIConnectionInformation>();
+FNDIFinderService::FNDISourceCollectionDeltaEvent FNDIFinderService::EventOnNDISourceCollectionDelta;
+
+TMap<FString, FNDIFinderService::FCachedSource> FNDIFinderService::CachedSources;
+
+static const TCHAR* SOURCE_CACHE_HEADER = TEXT("NDIIO Source Cache 2");
+
+/** The least time (in seconds) between two writes of the source cache while discovering */
+static const double SOURCE_CACHE_SAVE_INTERVAL = 5.0;
+
+static FString GetSourceCacheFilename()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("NDIIO"), TEXT("SourceCache.txt"));
+}
 
 /** ************************ **/
 
 FNDIFinderService::FNDIFinderService()
+	: bIsDefaultService(true)
+	, Scope(GetDefault<UNDIIOPluginSettings>()->DiscoveryScope)
 {
-	if (NDI_FIND_INSTANCE == nullptr)
-	{
-		FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+	RecreateFindInstance();
 
-		NDI_FIND_INSTANCE = NDIlib_find_create_v2(nullptr);
-	}
+	FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+	if (NDI_DEFAULT_FINDER_SERVICE == nullptr)
+		NDI_DEFAULT_FINDER_SERVICE = this;
+}
+
+FNDIFinderService::FNDIFinderService(const FNDIDiscoveryScope& InScope)
+	: bIsDefaultService(false)
+	, Scope(InScope)
+{
+	RecreateFindInstance();
+}
+
+FNDIFinderService::~FNDIFinderService()
+{
+	Shutdown();
+
+	FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+	if (NDI_DEFAULT_FINDER_SERVICE == this)
+		NDI_DEFAULT_FINDER_SERVICE = nullptr;
 }
 
 // Begin the service
@@ -35,8 +71,12 @@ bool FNDIFinderService::Start()
 {
 	if (!bIsThreadRunning && p_RunnableThread == nullptr)
 	{
-		if (NDI_FIND_INSTANCE != nullptr)
+		if (p_find_instance != nullptr)
 		{
+			// Make the sources of previous sessions available before discovery starts
+			if (bIsDefaultService)
+				LoadSourceCache();
+
 			this->bIsThreadRunning = true;
 			p_RunnableThread = FRunnableThread::Create(this, TEXT("FNDIFinderService_Tick"), 0, TPri_BelowNormal);
 
@@ -50,7 +90,7 @@ bool FNDIFinderService::Start()
 /** FRunnable Interface implementation for 'Init' */
 bool FNDIFinderService::Init()
 {
-	return NDI_FIND_INSTANCE != nullptr;
+	return p_find_instance != nullptr;
 }
 
 /** FRunnable Interface implementation for 'Stop' */
@@ -58,25 +98,54 @@ uint32 FNDIFinderService::Run()
 {
 	static const uint32 find_wait_time = 500;
 
-	if (NDI_FIND_INSTANCE == nullptr)
-		return 0;
-
 	// Only update when we are suppose to run
 	while (bIsThreadRunning)
 	{
+		// A change of scope takes a new finder, which is only replaced on this thread
+		if (bIsScopeChangePending)
+		{
+			bIsScopeChangePending = false;
+			RecreateFindInstance();
+		}
+
+		if (p_find_instance == nullptr)
+		{
+			FPlatformProcess::Sleep(find_wait_time / 1000.f);
+			continue;
+		}
+
 		// Wait up to 'find_wait_time' (in milliseconds) to determine whether new sources have been added
-		if (!NDIlib_find_wait_for_sources(NDI_FIND_INSTANCE, find_wait_time))
+		if (!NDIlib_find_wait_for_sources(p_find_instance, find_wait_time))
 		{
 			// alright the source collection has stopped updating, did we change the network source collection?
-			if (UpdateNetworkSourceCollection())
+			FNDISourceCollectionDelta Delta;
+			if (UpdateNetworkSourceCollection(Delta))
 			{
+				if (bIsDefaultService)
+					bIsSourceCacheDirty = true;
+
 				// Broadcast the even on the game thread for thread safety purposes
-				AsyncTask(ENamedThreads::GameThread, []() {
-					if (FNDIFinderService::EventOnNDISourceCollectionChanged.IsBound())
-						FNDIFinderService::EventOnNDISourceCollectionChanged.Broadcast();
+				AsyncTask(ENamedThreads::GameThread, [bIsDefaultService = bIsDefaultService, WeakDeltaEvent = TWeakPtr<FNDISourceCollectionDeltaEvent, ESPMode::ThreadSafe>(SourceCollectionDeltaEvent), Delta = MoveTemp(Delta)]() {
+					if (TSharedPtr<FNDISourceCollectionDeltaEvent, ESPMode::ThreadSafe> DeltaEvent = WeakDeltaEvent.Pin())
+					{
+						if (DeltaEvent->IsBound())
+							DeltaEvent->Broadcast(Delta);
+					}
+
+					if (bIsDefaultService)
+					{
+						if (FNDIFinderService::EventOnNDISourceCollectionDelta.IsBound())
+							FNDIFinderService::EventOnNDISourceCollectionDelta.Broadcast(Delta);
+						if (FNDIFinderService::EventOnNDISourceCollectionChanged.IsBound())
+							FNDIFinderService::EventOnNDISourceCollectionChanged.Broadcast();
+					}
 				});
 			}
 		}
+
+		// Sources can come and go in bursts, so the cache is written once they have settled
+		if (bIsDefaultService)
+			SaveSourceCacheIfDirty();
 	}
 
 	// return success
@@ -91,133 +160,515 @@ void FNDIFinderService::Shutdown()
 		this->bIsThreadRunning = false;
 
 		p_RunnableThread->WaitForCompletion();
+		delete p_RunnableThread;
 		p_RunnableThread = nullptr;
+
+		if (bIsDefaultService)
+			SaveSourceCache();
 	}
 
 	// Ensure we unload the finder instance
-	if (NDI_FIND_INSTANCE != nullptr)
-		NDIlib_find_destroy(NDI_FIND_INSTANCE);
+	if (p_find_instance != nullptr)
+		NDIlib_find_destroy(p_find_instance);
+	p_find_instance = nullptr;
 }
 
 // Stop the service
 void FNDIFinderService::Stop()
 {
-	Shutdown();
+	bIsThreadRunning = false;
 }
 
-bool FNDIFinderService::UpdateNetworkSourceCollection()
+/**
+	Creates the NDI finder for the current scope, destroying the previous one
+*/
+void FNDIFinderService::RecreateFindInstance()
+{
+	if (p_find_instance != nullptr)
+		NDIlib_find_destroy(p_find_instance);
+	p_find_instance = nullptr;
+
+	const FNDIDiscoveryScope CurrentScope = GetScope();
+
+	// Beware of the limited lifetime of TCHAR_TO_UTF8 values
+	std::string GroupsStr(TCHAR_TO_UTF8(*CurrentScope.GetGroupsString()));
+	std::string ExtraIPsStr(TCHAR_TO_UTF8(*CurrentScope.GetExtraIPsString()));
+
+	NDIlib_find_create_t settings;
+	settings.show_local_sources = CurrentScope.bShowLocalSources;
+	settings.p_groups = GroupsStr.empty() ? nullptr : GroupsStr.c_str();
+	settings.p_extra_ips = ExtraIPsStr.empty() ? nullptr : ExtraIPsStr.c_str();
+
+	p_find_instance = NDIlib_find_create_v2(&settings);
+}
+
+/** Returns the scope this service discovers sources within */
+FNDIDiscoveryScope FNDIFinderService::GetScope() const
+{
+	FScopeLock Lock(&SyncContext);
+
+	return Scope;
+}
+
+/**
+	Changes the scope this service discovers sources within. The sources are discovered again from scratch
+*/
+void FNDIFinderService::SetScope(const FNDIDiscoveryScope& InScope)
+{
+	{
+		FScopeLock Lock(&SyncContext);
+
+		if (Scope == InScope)
+			return;
+
+		Scope = InScope;
+	}
+
+	if (bIsThreadRunning)
+		bIsScopeChangePending = true;
+	else
+		RecreateFindInstance();
+}
+
+/**
+	Applies this change to a copy of the collection, which is up to date with 'InOutGeneration', without copying the
+	sources which did not change
+*/
+bool FNDISourceCollectionDelta::ApplyTo(TArray<FNDIConnectionInformation>& InOutSources, uint64& InOutGeneration) const
+{
+	if (Generation <= InOutGeneration)
+		return true;
+
+	if (Generation != InOutGeneration + 1)
+		return false;
+
+	for (const FNDIConnectionInformation& Source : Removed)
+	{
+		InOutSources.RemoveAll([&Source](const FNDIConnectionInformation& Existing)
+		{
+			return Existing.SourceName.Equals(Source.SourceName, ESearchCase::IgnoreCase);
+		});
+	}
+
+	for (const FNDIConnectionInformation& Source : Changed)
+	{
+		for (FNDIConnectionInformation& Existing : InOutSources)
+		{
+			if (Existing.SourceName.Equals(Source.SourceName, ESearchCase::IgnoreCase))
+				Existing.Url = Source.Url;
+		}
+	}
+
+	InOutSources.Append(Added);
+
+	InOutGeneration = Generation;
+	return true;
+}
+
+/**
+	Brings the network source collection up to date with the sources currently found, reusing the entries of the
+	sources which were already known, and describes what changed in 'OutDelta'
+*/
+bool FNDIFinderService::UpdateNetworkSourceCollection(FNDISourceCollectionDelta& OutDelta)
 {
 	uint32 no_sources = 0;
 	bool bHasCollectionChanged = false;
 
-	if (NDI_FIND_INSTANCE != nullptr)
+	if (p_find_instance != nullptr)
 	{
-		const NDIlib_source_t* p_sources = NDIlib_find_get_current_sources(NDI_FIND_INSTANCE, &no_sources);
+		const NDIlib_source_t* p_sources = NDIlib_find_get_current_sources(p_find_instance, &no_sources);
+		if (p_sources == nullptr)
+			no_sources = 0;
 
 		// Change Scope
 		{
-			FScopeLock lock(&NDI_FIND_SYNC_CONTEXT);
+			FScopeLock lock(&SyncContext);
+
+			TArray<FNDIConnectionInformation> UpdatedSourceCollection;
+			UpdatedSourceCollection.Reserve(no_sources);
 
-			bHasCollectionChanged = FNDIFinderService::NetworkSourceCollection.Num() != no_sources;
+			TBitArray<> IsSourceFound(false, NetworkSourceCollection.Num());
 
-			if (no_sources > 0 && p_sources != nullptr)
+			for (uint32 iter = 0; iter < no_sources; iter++)
 			{
-				uint32 CurrentSourceCount = NetworkSourceCollection.Num();
+				const NDIlib_source_t* SourceInformation = &p_sources[iter];
+				const FString SourceName = SourceInformation->p_ndi_name;
+				const FString Url = SourceInformation->p_url_address;
 
-				for (uint32 iter = 0; iter < no_sources; iter++)
+				// Known sources keep their entry, only the location on the network may have changed
+				if (const int32* SourceIndex = NetworkSourceIndexByName.Find(SourceName))
 				{
-					if (iter >= CurrentSourceCount)
+					if (!IsSourceFound[*SourceIndex])
 					{
-						NetworkSourceCollection.Add(FNDIConnectionInformation());
+						IsSourceFound[*SourceIndex] = true;
+
+						FNDIConnectionInformation& CollectionSource = UpdatedSourceCollection.Add_GetRef(MoveTemp(NetworkSourceCollection[*SourceIndex]));
+						if (CollectionSource.Url != Url)
+						{
+							CollectionSource.Url = Url;
+							OutDelta.Changed.Add(CollectionSource);
+						}
+						continue;
 					}
+				}
 
-					const NDIlib_source_t* SourceInformation = &p_sources[iter];
-					FNDIConnectionInformation* CollectionSource = &NetworkSourceCollection[iter];
+				// New sources have their name split into the machine and stream names once
+				FNDIConnectionInformation& CollectionSource = UpdatedSourceCollection.AddDefaulted_GetRef();
+				CollectionSource.Url = Url;
+				CollectionSource.SourceName = SourceName;
+				SourceName.Split(TEXT(" "), &CollectionSource.MachineName, &CollectionSource.StreamName);
 
-					bHasCollectionChanged |= SourceInformation->p_url_address != CollectionSource->Url;
-					CollectionSource->Url = SourceInformation->p_url_address;
-					CollectionSource->SourceName = SourceInformation->p_ndi_name;
-					FString SourceName = SourceInformation->p_ndi_name;
-					SourceName.Split(TEXT(" "), &CollectionSource->MachineName, &CollectionSource->StreamName);
+				// Now that the MachineName and StreamName have been split, cleanup the stream name
+				CollectionSource.StreamName.RemoveFromStart("(");
+				CollectionSource.StreamName.RemoveFromEnd(")");
 
-					// Now that the MachineName and StreamName have been split, cleanup the stream name
-					CollectionSource->StreamName.RemoveFromStart("(");
-					CollectionSource->StreamName.RemoveFromEnd(")");
-				}
+				OutDelta.Added.Add(CollectionSource);
+			}
+
+			for (int32 SourceIndex = 0; SourceIndex < NetworkSourceCollection.Num(); ++SourceIndex)
+			{
+				if (!IsSourceFound[SourceIndex])
+					OutDelta.Removed.Add(MoveTemp(NetworkSourceCollection[SourceIndex]));
+			}
 
-				if (CurrentSourceCount > no_sources)
+			bHasCollectionChanged = (OutDelta.Added.Num() > 0) || (OutDelta.Removed.Num() > 0) || (OutDelta.Changed.Num() > 0);
+
+			// The order of the sources is part of the collection too
+			if (!bHasCollectionChanged)
+			{
+				for (int32 SourceIndex = 0; SourceIndex < UpdatedSourceCollection.Num(); ++SourceIndex)
 				{
-					NetworkSourceCollection.RemoveAt(no_sources, CurrentSourceCount - no_sources, true);
-					bHasCollectionChanged = true;
+					if (NetworkSourceIndexByName.FindChecked(UpdatedSourceCollection[SourceIndex].SourceName) != SourceIndex)
+					{
+						bHasCollectionChanged = true;
+						break;
+					}
 				}
 			}
-			else if (NetworkSourceCollection.Num() > 0)
+
+			NetworkSourceCollection = MoveTemp(UpdatedSourceCollection);
+
+			if (bHasCollectionChanged)
 			{
-				NetworkSourceCollection.Empty();
-				bHasCollectionChanged = true;
+				NetworkSourceIndexByName.Reset();
+				NetworkSourceIndexByUrl.Reset();
+				for (int32 SourceIndex = 0; SourceIndex < NetworkSourceCollection.Num(); ++SourceIndex)
+				{
+					NetworkSourceIndexByName.Add(NetworkSourceCollection[SourceIndex].SourceName, SourceIndex);
+					NetworkSourceIndexByUrl.Add(NetworkSourceCollection[SourceIndex].Url, SourceIndex);
+				}
+
+				OutDelta.Generation = ++NetworkSourceGeneration;
 			}
+		}
 
-			bHasCollectionChanged |= NetworkSourceCollection.Num() != no_sources;
+		// Remember where the sources were found, for the next session
+		if (bIsDefaultService && bHasCollectionChanged)
+		{
+			FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+			const int64 Now = FDateTime::UtcNow().ToUnixTimestamp();
+			for (const FNDIConnectionInformation& Source : OutDelta.Added)
+				CachedSources.Add(Source.SourceName, FCachedSource { Source.Url, Now, 0, true });
+			for (const FNDIConnectionInformation& Source : OutDelta.Changed)
+				CachedSources.Add(Source.SourceName, FCachedSource { Source.Url, Now, 0, true });
 		}
 	}
 
 	return bHasCollectionChanged;
 }
 
-/** Call to update an existing collection of network sources to match the current collection */
-bool FNDIFinderService::UpdateSourceCollection(TArray<FNDIConnectionInformation>& InSourceCollection)
+/** Updates an existing collection of sources to match 'InSources' */
+static bool CopySourceCollection(const TArray<FNDIConnectionInformation>& InSources, TArray<FNDIConnectionInformation>& InSourceCollection)
 {
 	bool bHasCollectionChanged = false;
 
-	{
-		FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+	const uint32& no_sources = InSources.Num();
+	bHasCollectionChanged = InSourceCollection.Num() != no_sources;
 
-		const uint32& no_sources = NetworkSourceCollection.Num();
-		bHasCollectionChanged = InSourceCollection.Num() != no_sources;
+	if (no_sources > 0)
+	{
+		uint32 CurrentSourceCount = InSourceCollection.Num();
 
-		if (no_sources > 0)
+		for (uint32 iter = 0; iter < no_sources; iter++)
 		{
-			uint32 CurrentSourceCount = InSourceCollection.Num();
-
-			for (uint32 iter = 0; iter < no_sources; iter++)
+			if (iter >= CurrentSourceCount)
 			{
-				if (iter >= CurrentSourceCount)
-				{
-					InSourceCollection.Add(FNDIConnectionInformation());
-					CurrentSourceCount = InSourceCollection.Num();
-				}
-
-				FNDIConnectionInformation* CollectionSource = &InSourceCollection[iter];
-				const FNDIConnectionInformation* SourceInformation = &NetworkSourceCollection[iter];
+				InSourceCollection.Add(FNDIConnectionInformation());
+				CurrentSourceCount = InSourceCollection.Num();
+			}
 
-				bHasCollectionChanged |= SourceInformation->Url != CollectionSource->Url;
+			FNDIConnectionInformation* CollectionSource = &InSourceCollection[iter];
+			const FNDIConnectionInformation* SourceInformation = &InSources[iter];
 
-				CollectionSource->Url = SourceInformation->Url;
-				CollectionSource->SourceName = SourceInformation->SourceName;
-				CollectionSource->MachineName = SourceInformation->MachineName;
-				CollectionSource->StreamName = SourceInformation->StreamName;
-			}
+			bHasCollectionChanged |= SourceInformation->Url != CollectionSource->Url;
 
-			if (CurrentSourceCount > no_sources)
-			{
-				InSourceCollection.RemoveAt(no_sources, CurrentSourceCount - no_sources, true);
-				bHasCollectionChanged = true;
-			}
+			CollectionSource->Url = SourceInformation->Url;
+			CollectionSource->SourceName = SourceInformation->SourceName;
+			CollectionSource->MachineName = SourceInformation->MachineName;
+			CollectionSource->StreamName = SourceInformation->StreamName;
 		}
-		else if (InSourceCollection.Num() > 0)
+
+		if (CurrentSourceCount > no_sources)
 		{
-			InSourceCollection.Empty();
+			InSourceCollection.RemoveAt(no_sources, CurrentSourceCount - no_sources, true);
 			bHasCollectionChanged = true;
 		}
 	}
+	else if (InSourceCollection.Num() > 0)
+	{
+		InSourceCollection.Empty();
+		bHasCollectionChanged = true;
+	}
 
 	return bHasCollectionChanged;
 }
 
+/** Get the sources found by this service */
+TArray<FNDIConnectionInformation> FNDIFinderService::GetSources() const
+{
+	FScopeLock Lock(&SyncContext);
+
+	return NetworkSourceCollection;
+}
+
+/**
+	Call to update an existing collection of sources to match the sources found by this service, if it was last
+	updated for another generation than the current one
+*/
+bool FNDIFinderService::UpdateSources(TArray<FNDIConnectionInformation>& InSourceCollection, uint64& InOutGeneration) const
+{
+	FScopeLock Lock(&SyncContext);
+
+	if (InOutGeneration == NetworkSourceGeneration)
+		return false;
+
+	InOutGeneration = NetworkSourceGeneration;
+
+	CopySourceCollection(NetworkSourceCollection, InSourceCollection);
+
+	return true;
+}
+
+/** Returns the generation of the sources found by this service, which increases every time they change */
+uint64 FNDIFinderService::GetGeneration() const
+{
+	FScopeLock Lock(&SyncContext);
+
+	return NetworkSourceGeneration;
+}
+
+/** Finds a source found by this service by its name (case insensitive) */
+bool FNDIFinderService::FindSourceByName(const FString& InSourceName, FNDIConnectionInformation& OutConnectionInformation) const
+{
+	FScopeLock Lock(&SyncContext);
+
+	if (const int32* SourceIndex = NetworkSourceIndexByName.Find(InSourceName))
+	{
+		OutConnectionInformation = NetworkSourceCollection[*SourceIndex];
+		return true;
+	}
+
+	return false;
+}
+
+/** Finds a source found by this service by its location on the network */
+bool FNDIFinderService::FindSourceByUrl(const FString& InUrl, FNDIConnectionInformation& OutConnectionInformation) const
+{
+	FScopeLock Lock(&SyncContext);
+
+	if (const int32* SourceIndex = NetworkSourceIndexByUrl.Find(InUrl))
+	{
+		OutConnectionInformation = NetworkSourceCollection[*SourceIndex];
+		return true;
+	}
+
+	return false;
+}
+
+/** Call to update an existing collection of network sources to match the current collection */
+bool FNDIFinderService::UpdateSourceCollection(TArray<FNDIConnectionInformation>& InSourceCollection)
+{
+	FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+	if (NDI_DEFAULT_FINDER_SERVICE == nullptr)
+		return CopySourceCollection(TArray<FNDIConnectionInformation>(), InSourceCollection);
+
+	FScopeLock ServiceLock(&NDI_DEFAULT_FINDER_SERVICE->SyncContext);
+
+	return CopySourceCollection(NDI_DEFAULT_FINDER_SERVICE->NetworkSourceCollection, InSourceCollection);
+}
+
+/**
+	Call to update an existing collection of network sources to match the current collection, if it was last
+	updated for another generation than the current one
+*/
+bool FNDIFinderService::UpdateSourceCollection(TArray<FNDIConnectionInformation>& InSourceCollection, uint64& InOutGeneration)
+{
+	FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+	return (NDI_DEFAULT_FINDER_SERVICE != nullptr) && NDI_DEFAULT_FINDER_SERVICE->UpdateSources(InSourceCollection, InOutGeneration);
+}
+
+/** Returns the generation of the collection of network sources, which increases every time it changes */
+uint64 FNDIFinderService::GetNetworkSourceGeneration()
+{
+	FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+	return (NDI_DEFAULT_FINDER_SERVICE != nullptr) ? NDI_DEFAULT_FINDER_SERVICE->GetGeneration() : 0;
+}
+
+/** Finds a network source by its name (case insensitive), without copying the collection */
+bool FNDIFinderService::FindNetworkSourceByName(const FString& InSourceName, FNDIConnectionInformation& OutConnectionInformation)
+{
+	FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+	return (NDI_DEFAULT_FINDER_SERVICE != nullptr) && NDI_DEFAULT_FINDER_SERVICE->FindSourceByName(InSourceName, OutConnectionInformation);
+}
+
+/** Finds a network source by its location on the network, without copying the collection */
+bool FNDIFinderService::FindNetworkSourceByUrl(const FString& InUrl, FNDIConnectionInformation& OutConnectionInformation)
+{
+	FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+	return (NDI_DEFAULT_FINDER_SERVICE != nullptr) && NDI_DEFAULT_FINDER_SERVICE->FindSourceByUrl(InUrl, OutConnectionInformation);
+}
+
+/**
+	Finds the location on the network where a source was last seen, in this or a previous session
+*/
+bool FNDIFinderService::FindCachedSourceUrl(const FString& InSourceName, FString& OutUrl)
+{
+	FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+	FNDIConnectionInformation NetworkSource;
+	if ((NDI_DEFAULT_FINDER_SERVICE != nullptr) && NDI_DEFAULT_FINDER_SERVICE->FindSourceByName(InSourceName, NetworkSource))
+	{
+		OutUrl = NetworkSource.Url;
+		return !OutUrl.IsEmpty();
+	}
+
+	if (const FCachedSource* CachedSource = CachedSources.Find(InSourceName))
+	{
+		OutUrl = CachedSource->Url;
+		return !OutUrl.IsEmpty();
+	}
+
+	return false;
+}
+
+/** Returns the discovery scope of the network source collection */
+FNDIDiscoveryScope FNDIFinderService::GetNetworkDiscoveryScope()
+{
+	FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+	return (NDI_DEFAULT_FINDER_SERVICE != nullptr) ? NDI_DEFAULT_FINDER_SERVICE->GetScope() : GetDefault<UNDIIOPluginSettings>()->DiscoveryScope;
+}
+
+/** Changes the discovery scope of the network source collection */
+void FNDIFinderService::SetNetworkDiscoveryScope(const FNDIDiscoveryScope& InScope)
+{
+	FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+	if (NDI_DEFAULT_FINDER_SERVICE != nullptr)
+		NDI_DEFAULT_FINDER_SERVICE->SetScope(InScope);
+}
+
+/**
+	Reads the sources seen in previous sessions, leaving out those which have expired
+*/
+void FNDIFinderService::LoadSourceCache()
+{
+	const UNDIIOPluginSettings* CoreSettings = GetDefault<UNDIIOPluginSettings>();
+	bIsSourceCacheEnabled = CoreSettings->bCacheNetworkSources;
+	SourceCacheExpirySeconds = FMath::Max(CoreSettings->SourceCacheExpiryHours, 0.f) * 3600.0;
+	SourceCacheMaxMissedSessions = FMath::Max(CoreSettings->SourceCacheMaxMissedSessions, 1);
+
+	if (!bIsSourceCacheEnabled)
+		return;
+
+	// A cache written by another version is left to be replaced
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *GetSourceCacheFilename()) || (Lines.Num() == 0) || (Lines[0] != SOURCE_CACHE_HEADER))
+		return;
+
+	const int64 Now = FDateTime::UtcNow().ToUnixTimestamp();
+
+	FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		// Every line is the time the source was last seen, the number of sessions it was missed in, its url and its
+		// name, separated by tabs
+		TArray<FString> Fields;
+		if (Lines[LineIndex].ParseIntoArray(Fields, TEXT("\t"), false) != 4)
+			continue;
+
+		const FString& SourceName = Fields[3];
+		FCachedSource CachedSource { Fields[2], FCString::Atoi64(*Fields[0]), FCString::Atoi(*Fields[1]), false };
+		if (SourceName.IsEmpty() || CachedSource.Url.IsEmpty() || ((Now - CachedSource.LastSeen) > SourceCacheExpirySeconds))
+			continue;
+
+		// Sources found in this session are more recent
+		if (!CachedSources.Contains(SourceName))
+			CachedSources.Add(SourceName, MoveTemp(CachedSource));
+	}
+}
+
+/**
+	Writes the sources seen in this and previous sessions
+*/
+void FNDIFinderService::SaveSourceCache()
+{
+	if (!bIsSourceCacheEnabled)
+		return;
+
+	const int64 Now = FDateTime::UtcNow().ToUnixTimestamp();
+
+	const TArray<FNDIConnectionInformation> Sources = GetSources();
+
+	FString CacheText = FString(SOURCE_CACHE_HEADER) + LINE_TERMINATOR;
+
+	{
+		FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
+
+		// The sources which are currently found were seen just now
+		for (const FNDIConnectionInformation& Source : Sources)
+			CachedSources.Add(Source.SourceName, FCachedSource { Source.Url, Now, 0, true });
+
+		// Sources which were not seen for too long, or not found again in too many sessions, are forgotten.  A source
+		// which was not found in this session (yet) counts as missed in it
+		for (auto It = CachedSources.CreateIterator(); It; ++It)
+		{
+			const FCachedSource& CachedSource = It.Value();
+			const int32 MissedSessions = CachedSource.bIsSeenThisSession ? 0 : CachedSource.MissedSessions + 1;
+
+			if (((Now - CachedSource.LastSeen) > SourceCacheExpirySeconds) || (MissedSessions >= SourceCacheMaxMissedSessions))
+				It.RemoveCurrent();
+			else
+				CacheText += FString::Printf(TEXT("%lld\t%d\t%s\t%s"), CachedSource.LastSeen, MissedSessions, *CachedSource.Url, *It.Key()) + LINE_TERMINATOR;
+		}
+	}
+
+	FFileHelper::SaveStringToFile(CacheText, *GetSourceCacheFilename());
+
+	bIsSourceCacheDirty = false;
+	LastSourceCacheSaveTime = FPlatformTime::Seconds();
+}
+
+/**
+	Writes the sources if they changed, at most once every few seconds
+*/
+void FNDIFinderService::SaveSourceCacheIfDirty()
+{
+	if (bIsSourceCacheDirty && ((FPlatformTime::Seconds() - LastSourceCacheSaveTime) >= SOURCE_CACHE_SAVE_INTERVAL))
+		SaveSourceCache();
+}
+
 /** Get the available sources on the network */
 const TArray<FNDIConnectionInformation> FNDIFinderService::GetNetworkSourceCollection()
 {
 	FScopeLock Lock(&NDI_FIND_SYNC_CONTEXT);
 
-	return FNDIFinderService::NetworkSourceCollection;
+	return (NDI_DEFAULT_FINDER_SERVICE != nullptr) ? NDI_DEFAULT_FINDER_SERVICE->GetSources() : TArray<FNDIConnectionInformation>();
 }
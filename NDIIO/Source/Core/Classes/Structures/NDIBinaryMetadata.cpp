@@ -0,0 +1,306 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDIBinaryMetadata.h>
+
+
+static constexpr uint8 BinaryMetadataFormatVersion = 1;
+static constexpr uint8 BinaryMetadataFlagDelta = 0x01;
+static constexpr int32 BinaryMetadataHeaderSize = 12;
+
+
+static void WriteUInt16(TArray<uint8>& Frame, uint16 Value)
+{
+	Frame.Add(static_cast<uint8>(Value & 0xFF));
+	Frame.Add(static_cast<uint8>((Value >> 8) & 0xFF));
+}
+
+static void WriteUInt32(TArray<uint8>& Frame, uint32 Value)
+{
+	Frame.Add(static_cast<uint8>(Value & 0xFF));
+	Frame.Add(static_cast<uint8>((Value >> 8) & 0xFF));
+	Frame.Add(static_cast<uint8>((Value >> 16) & 0xFF));
+	Frame.Add(static_cast<uint8>((Value >> 24) & 0xFF));
+}
+
+static void WriteVarint(TArray<uint8>& Frame, uint32 Value)
+{
+	while (Value >= 0x80)
+	{
+		Frame.Add(static_cast<uint8>((Value & 0x7F) | 0x80));
+		Value >>= 7;
+	}
+	Frame.Add(static_cast<uint8>(Value));
+}
+
+static uint16 ReadUInt16(const uint8* Data)
+{
+	return uint16(Data[0]) | (uint16(Data[1]) << 8);
+}
+
+static uint32 ReadUInt32(const uint8* Data)
+{
+	return uint32(Data[0]) | (uint32(Data[1]) << 8) | (uint32(Data[2]) << 16) | (uint32(Data[3]) << 24);
+}
+
+static bool ReadVarint(const TArray<uint8>& Frame, int32& Pos, uint32& OutValue)
+{
+	OutValue = 0;
+
+	for (int32 Shift = 0; (Shift < 32) && (Pos < Frame.Num()); Shift += 7)
+	{
+		const uint8 Byte = Frame[Pos++];
+		OutValue |= uint32(Byte & 0x7F) << Shift;
+		if ((Byte & 0x80) == 0)
+			return true;
+	}
+
+	return false;
+}
+
+static bool DecodeBase64(FAnsiStringView Encoded, TArray<uint8>& OutData)
+{
+	OutData.Reset();
+	OutData.Reserve((Encoded.Len() / 4) * 3);
+
+	uint32 Bits = 0;
+	int32 NumBits = 0;
+
+	for (const ANSICHAR Char : Encoded)
+	{
+		uint32 Value;
+		if ((Char >= 'A') && (Char <= 'Z'))
+			Value = Char - 'A';
+		else if ((Char >= 'a') && (Char <= 'z'))
+			Value = Char - 'a' + 26;
+		else if ((Char >= '0') && (Char <= '9'))
+			Value = Char - '0' + 52;
+		else if (Char == '+')
+			Value = 62;
+		else if (Char == '/')
+			Value = 63;
+		else if ((Char == '=') || (Char == ' ') || (Char == '\t') || (Char == '\r') || (Char == '\n'))
+			continue;
+		else
+			return false;
+
+		Bits = (Bits << 6) | Value;
+		NumBits += 6;
+
+		if (NumBits >= 8)
+		{
+			NumBits -= 8;
+			OutData.Add(static_cast<uint8>((Bits >> NumBits) & 0xFF));
+		}
+	}
+
+	return true;
+}
+
+
+FNDIBinaryMetadataEncoder::FNDIBinaryMetadataEncoder(FName InChannel)
+{
+	FTCHARToUTF8 Utf8Channel(*InChannel.ToString());
+	Channel.Append(Utf8Channel.Get(), Utf8Channel.Length());
+}
+
+void FNDIBinaryMetadataEncoder::SetDeltaEncoding(bool bInDeltaEncoding, int32 InKeyFrameInterval)
+{
+	bDeltaEncoding = bInDeltaEncoding;
+	KeyFrameInterval = FMath::Max(InKeyFrameInterval, 1);
+}
+
+void FNDIBinaryMetadataEncoder::Reset()
+{
+	bHasPreviousPayload = false;
+}
+
+void FNDIBinaryMetadataEncoder::Encode(uint16 PayloadVersion, TArrayView<const uint8> Payload, FNDIMetadataWriter& Metadata)
+{
+	const bool bDelta = bDeltaEncoding && bHasPreviousPayload && (PreviousPayloadVersion == PayloadVersion) &&
+	                    (PreviousPayload.Num() == Payload.Num()) && (FramesSinceKeyFrame < KeyFrameInterval);
+
+	Frame.Reset();
+	Frame.Add(BinaryMetadataFormatVersion);
+	Frame.Add(bDelta ? BinaryMetadataFlagDelta : uint8(0));
+	WriteUInt16(Frame, PayloadVersion);
+	WriteUInt32(Frame, Sequence);
+	WriteUInt32(Frame, Payload.Num());
+
+	if (bDelta)
+	{
+		const int32 Size = Payload.Num();
+		int32 i = 0;
+
+		while (i < Size)
+		{
+			const int32 ZerosStart = i;
+			while ((i < Size) && (Payload[i] == PreviousPayload[i]))
+				++i;
+
+			// A literal run only ends at two unchanged bytes in a row, as a single one is cheaper to keep
+			const int32 LiteralStart = i;
+			while ((i < Size) && !((Payload[i] == PreviousPayload[i]) && (((i + 1) >= Size) || (Payload[i + 1] == PreviousPayload[i + 1]))))
+				++i;
+
+			WriteVarint(Frame, LiteralStart - ZerosStart);
+			WriteVarint(Frame, i - LiteralStart);
+			for (int32 Literal = LiteralStart; Literal < i; ++Literal)
+				Frame.Add(static_cast<uint8>(Payload[Literal] ^ PreviousPayload[Literal]));
+		}
+	}
+	else
+	{
+		Frame.Append(Payload.GetData(), Payload.Num());
+	}
+
+	Metadata.OpenElement(NDIIO_BINARY_METADATA_ELEMENT)
+		.Attribute("channel", FAnsiStringView(Channel.GetData(), Channel.Num()))
+		.Base64(Frame)
+		.CloseElement();
+
+	PreviousPayload.Reset();
+	PreviousPayload.Append(Payload.GetData(), Payload.Num());
+	PreviousPayloadVersion = PayloadVersion;
+	bHasPreviousPayload = true;
+
+	FramesSinceKeyFrame = bDelta ? (FramesSinceKeyFrame + 1) : 1;
+	++Sequence;
+}
+
+
+bool FNDIBinaryMetadataDecoder::Decode(FAnsiStringView Encoded, uint16& OutPayloadVersion, TArrayView<const uint8>& OutPayload)
+{
+	if (!DecodeBase64(Encoded, Frame) || (Frame.Num() < BinaryMetadataHeaderSize))
+		return false;
+
+	const uint8 FormatVersion = Frame[0];
+	const uint8 Flags = Frame[1];
+	const uint16 PayloadVersion = ReadUInt16(&Frame[2]);
+	const uint32 Sequence = ReadUInt32(&Frame[4]);
+	const int32 Size = static_cast<int32>(ReadUInt32(&Frame[8]));
+
+	if ((FormatVersion != BinaryMetadataFormatVersion) || (Size < 0))
+		return false;
+
+	if ((Flags & BinaryMetadataFlagDelta) != 0)
+	{
+		// Only a frame which follows the previous one, in the same layout, can be applied to it.  Anything else
+		// means a frame was missed, and the channel picks up again at the next key frame
+		if (!bHasPreviousPayload || (Sequence != (PreviousSequence + 1)) || (PayloadVersion != PreviousPayloadVersion) || (Payload.Num() != Size))
+		{
+			bHasPreviousPayload = false;
+			return false;
+		}
+
+		int32 Pos = BinaryMetadataHeaderSize;
+		int32 i = 0;
+
+		while (Pos < Frame.Num())
+		{
+			uint32 Zeros, Literals;
+			if (!ReadVarint(Frame, Pos, Zeros) || !ReadVarint(Frame, Pos, Literals) ||
+				(int64(i) + Zeros + Literals > Size) || (int64(Pos) + Literals > Frame.Num()))
+			{
+				bHasPreviousPayload = false;
+				return false;
+			}
+
+			i += Zeros;
+			for (uint32 Literal = 0; Literal < Literals; ++Literal)
+				Payload[i++] ^= Frame[Pos++];
+		}
+	}
+	else
+	{
+		if ((Frame.Num() - BinaryMetadataHeaderSize) != Size)
+			return false;
+
+		Payload.Reset();
+		Payload.Append(Frame.GetData() + BinaryMetadataHeaderSize, Size);
+	}
+
+	bHasPreviousPayload = true;
+	PreviousSequence = Sequence;
+	PreviousPayloadVersion = PayloadVersion;
+
+	OutPayloadVersion = PayloadVersion;
+	OutPayload = Payload;
+
+	return true;
+}
+
+void FNDIBinaryMetadataDecoder::Reset()
+{
+	bHasPreviousPayload = false;
+}
+
+bool FNDIBinaryMetadataDecoder::ParseElement(FAnsiStringView Xml, FAnsiStringView& OutChannel, FAnsiStringView& OutEncoded)
+{
+	static constexpr int32 ElementNameLength = UE_ARRAY_COUNT(NDIIO_BINARY_METADATA_ELEMENT) - 1;
+
+	auto IsSpace = [](ANSICHAR Char) { return (Char == ' ') || (Char == '\t') || (Char == '\r') || (Char == '\n'); };
+
+	const ANSICHAR* Pos = Xml.GetData();
+	const ANSICHAR* End = Pos + Xml.Len();
+
+	while ((Pos < End) && (*Pos != '<'))
+		++Pos;
+	if (((End - Pos) < (ElementNameLength + 2)) || (FMemory::Memcmp(Pos + 1, NDIIO_BINARY_METADATA_ELEMENT, ElementNameLength) != 0))
+		return false;
+
+	Pos += ElementNameLength + 1;
+	if (!IsSpace(*Pos) && (*Pos != '>') && (*Pos != '/'))
+		return false;
+
+	OutChannel = FAnsiStringView();
+	OutEncoded = FAnsiStringView();
+
+	for (;;)
+	{
+		while ((Pos < End) && IsSpace(*Pos))
+			++Pos;
+		if (Pos >= End)
+			return false;
+
+		if (*Pos == '/')
+			return true;
+		if (*Pos == '>')
+			break;
+
+		const ANSICHAR* NameStart = Pos;
+		while ((Pos < End) && !IsSpace(*Pos) && (*Pos != '='))
+			++Pos;
+		const FAnsiStringView Name(NameStart, Pos - NameStart);
+
+		while ((Pos < End) && (*Pos != '"') && (*Pos != '\''))
+			++Pos;
+		if (Pos >= End)
+			return false;
+
+		const ANSICHAR Quote = *Pos++;
+		const ANSICHAR* ValueStart = Pos;
+		while ((Pos < End) && (*Pos != Quote))
+			++Pos;
+		if (Pos >= End)
+			return false;
+
+		if (Name.Equals(FAnsiStringView("channel"), ESearchCase::CaseSensitive))
+			OutChannel = FAnsiStringView(ValueStart, Pos - ValueStart);
+		++Pos;
+	}
+
+	const ANSICHAR* ContentStart = ++Pos;
+	while ((Pos < End) && (*Pos != '<'))
+		++Pos;
+	if (Pos >= End)
+		return false;
+
+	OutEncoded = FAnsiStringView(ContentStart, Pos - ContentStart);
+
+	return true;
+}
@@ -0,0 +1,33 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDIDiscoveryScope.h>
+
+/** Compares this object to 'other' and returns a determination of whether they are equal */
+bool FNDIDiscoveryScope::operator==(const FNDIDiscoveryScope& other) const
+{
+	return this->bShowLocalSources == other.bShowLocalSources && this->Groups == other.Groups &&
+	       this->ExtraIPs == other.ExtraIPs;
+}
+
+/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+bool FNDIDiscoveryScope::operator!=(const FNDIDiscoveryScope& other) const
+{
+	return !(*this == other);
+}
+
+/** Returns the groups as the comma separated list expected by NDI, or an empty string for the default groups */
+FString FNDIDiscoveryScope::GetGroupsString() const
+{
+	return FString::JoinBy(Groups, TEXT(","), [](const FString& Group) { return Group.TrimStartAndEnd(); });
+}
+
+/** Returns the extra IP addresses as the comma separated list expected by NDI */
+FString FNDIDiscoveryScope::GetExtraIPsString() const
+{
+	return FString::JoinBy(ExtraIPs, TEXT(","), [](const FString& Address) { return Address.TrimStartAndEnd(); });
+}
@@ -0,0 +1,346 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDIMetadataWriter.h>
+
+
+FNDIMetadataWriter::FNDIMetadataWriter()
+{
+	Buffer.Add('\0');
+}
+
+FNDIMetadataWriter::FNDIMetadataWriter(int32 InitialCapacity)
+{
+	Buffer.Reserve(InitialCapacity + 1);
+	Buffer.Add('\0');
+}
+
+void FNDIMetadataWriter::Reset()
+{
+	Buffer.Reset();
+	Buffer.Add('\0');
+
+	ElementStack.Reset();
+	bIsStartTagOpen = false;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::OpenElement(FAnsiStringView Name)
+{
+	BeginContent();
+
+	Append('<');
+	ElementStack.Emplace(Len(), Name.Len());
+	Append(Name.GetData(), Name.Len());
+
+	bIsStartTagOpen = true;
+
+	return *this;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::OpenElement(const ANSICHAR* Name)
+{
+	return OpenElement(FAnsiStringView(Name));
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::OpenElement(const FString& Name)
+{
+	FTCHARToUTF8 Utf8Name(*Name);
+	return OpenElement(FAnsiStringView(Utf8Name.Get(), Utf8Name.Length()));
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Attribute(FAnsiStringView Name, FAnsiStringView Value)
+{
+	BeginAttribute(Name);
+	AppendEscaped(Value, true);
+	EndAttribute();
+
+	return *this;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Attribute(FAnsiStringView Name, const ANSICHAR* Value)
+{
+	return Attribute(Name, FAnsiStringView(Value));
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Attribute(FAnsiStringView Name, const FString& Value)
+{
+	FTCHARToUTF8 Utf8Value(*Value);
+	return Attribute(Name, FAnsiStringView(Utf8Value.Get(), Utf8Value.Length()));
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Attribute(FAnsiStringView Name, bool Value)
+{
+	return Attribute(Name, Value ? FAnsiStringView("true", 4) : FAnsiStringView("false", 5));
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Attribute(FAnsiStringView Name, int32 Value)
+{
+	return Attribute(Name, static_cast<int64>(Value));
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Attribute(FAnsiStringView Name, int64 Value)
+{
+	ANSICHAR Number[32];
+	const int32 NumberLength = FCStringAnsi::Snprintf(Number, sizeof(Number), "%lld", static_cast<long long>(Value));
+
+	BeginAttribute(Name);
+	Append(Number, NumberLength);
+	EndAttribute();
+
+	return *this;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Attribute(FAnsiStringView Name, float Value)
+{
+	ANSICHAR Number[32];
+	const int32 NumberLength = FCStringAnsi::Snprintf(Number, sizeof(Number), "%.9g", static_cast<double>(Value));
+
+	BeginAttribute(Name);
+	Append(Number, NumberLength);
+	EndAttribute();
+
+	return *this;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Attribute(FAnsiStringView Name, double Value)
+{
+	BeginAttribute(Name);
+	AppendNumbers(&Value, 1);
+	EndAttribute();
+
+	return *this;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Attribute(FAnsiStringView Name, const FVector& Value)
+{
+	const double Values[] = { Value.X, Value.Y, Value.Z };
+
+	BeginAttribute(Name);
+	AppendNumbers(Values, UE_ARRAY_COUNT(Values));
+	EndAttribute();
+
+	return *this;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Attribute(FAnsiStringView Name, const FRotator& Value)
+{
+	const double Values[] = { Value.Pitch, Value.Yaw, Value.Roll };
+
+	BeginAttribute(Name);
+	AppendNumbers(Values, UE_ARRAY_COUNT(Values));
+	EndAttribute();
+
+	return *this;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Attribute(FAnsiStringView Name, const FQuat& Value)
+{
+	const double Values[] = { Value.X, Value.Y, Value.Z, Value.W };
+
+	BeginAttribute(Name);
+	AppendNumbers(Values, UE_ARRAY_COUNT(Values));
+	EndAttribute();
+
+	return *this;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Attribute(FAnsiStringView Name, const FTransform& Value)
+{
+	const FVector Translation = Value.GetTranslation();
+	const FQuat Rotation = Value.GetRotation();
+	const FVector Scale = Value.GetScale3D();
+
+	const double Values[] = { Translation.X, Translation.Y, Translation.Z,
+	                          Rotation.X, Rotation.Y, Rotation.Z, Rotation.W,
+	                          Scale.X, Scale.Y, Scale.Z };
+
+	BeginAttribute(Name);
+	AppendNumbers(Values, UE_ARRAY_COUNT(Values));
+	EndAttribute();
+
+	return *this;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Text(FAnsiStringView Value)
+{
+	BeginContent();
+	AppendEscaped(Value, false);
+
+	return *this;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Text(const FString& Value)
+{
+	FTCHARToUTF8 Utf8Value(*Value);
+	return Text(FAnsiStringView(Utf8Value.Get(), Utf8Value.Length()));
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Base64(TArrayView<const uint8> Data)
+{
+	static const ANSICHAR Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	BeginContent();
+
+	// Encoded straight into the buffer
+	const int32 EncodedLength = ((Data.Num() + 2) / 3) * 4;
+	const int32 Offset = Len();
+	Buffer.AddUninitialized(EncodedLength);
+	ANSICHAR* Out = Buffer.GetData() + Offset;
+
+	int32 i = 0;
+	for (; (i + 2) < Data.Num(); i += 3)
+	{
+		const uint32 Triple = (uint32(Data[i]) << 16) | (uint32(Data[i + 1]) << 8) | uint32(Data[i + 2]);
+		*Out++ = Alphabet[(Triple >> 18) & 0x3F];
+		*Out++ = Alphabet[(Triple >> 12) & 0x3F];
+		*Out++ = Alphabet[(Triple >> 6) & 0x3F];
+		*Out++ = Alphabet[Triple & 0x3F];
+	}
+
+	if (i < Data.Num())
+	{
+		const bool bTwoBytes = (i + 1) < Data.Num();
+		const uint32 Triple = (uint32(Data[i]) << 16) | (bTwoBytes ? (uint32(Data[i + 1]) << 8) : 0);
+		*Out++ = Alphabet[(Triple >> 18) & 0x3F];
+		*Out++ = Alphabet[(Triple >> 12) & 0x3F];
+		*Out++ = bTwoBytes ? Alphabet[(Triple >> 6) & 0x3F] : '=';
+		*Out++ = '=';
+	}
+
+	Buffer.Last() = '\0';
+
+	return *this;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Raw(FAnsiStringView Value)
+{
+	BeginContent();
+	Append(Value.GetData(), Value.Len());
+
+	return *this;
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::Raw(const FString& Value)
+{
+	FTCHARToUTF8 Utf8Value(*Value);
+	return Raw(FAnsiStringView(Utf8Value.Get(), Utf8Value.Length()));
+}
+
+FNDIMetadataWriter& FNDIMetadataWriter::CloseElement()
+{
+	check(ElementStack.Num() > 0);
+
+	const TPair<int32, int32> Element = ElementStack.Pop();
+
+	if (bIsStartTagOpen)
+	{
+		Append("/>", 2);
+		bIsStartTagOpen = false;
+	}
+	else
+	{
+		// Make room first, as the name is copied from the buffer itself
+		Buffer.Reserve(Buffer.Num() + Element.Value + 3);
+
+		Append("</", 2);
+		Append(Buffer.GetData() + Element.Key, Element.Value);
+		Append('>');
+	}
+
+	return *this;
+}
+
+FString FNDIMetadataWriter::ToString() const
+{
+	return FString(UTF8_TO_TCHAR(GetData()));
+}
+
+void FNDIMetadataWriter::Append(const ANSICHAR* Data, int32 Length)
+{
+	if (Length <= 0)
+		return;
+
+	// Keep the terminator at the end of the buffer
+	const int32 Offset = Buffer.Num() - 1;
+	Buffer.AddUninitialized(Length);
+	FMemory::Memmove(Buffer.GetData() + Offset, Data, Length);
+	Buffer.Last() = '\0';
+}
+
+void FNDIMetadataWriter::Append(ANSICHAR Char)
+{
+	Buffer.Last() = Char;
+	Buffer.Add('\0');
+}
+
+void FNDIMetadataWriter::AppendEscaped(FAnsiStringView Value, bool bInAttribute)
+{
+	const ANSICHAR* Run = Value.GetData();
+	const ANSICHAR* End = Run + Value.Len();
+
+	for (const ANSICHAR* Pos = Run; Pos < End; ++Pos)
+	{
+		const ANSICHAR* Entity = nullptr;
+		int32 EntityLength = 0;
+
+		switch (*Pos)
+		{
+			case '&': Entity = "&amp;"; EntityLength = 5; break;
+			case '<': Entity = "&lt;"; EntityLength = 4; break;
+			case '>': Entity = "&gt;"; EntityLength = 4; break;
+			case '"': if (bInAttribute) { Entity = "&quot;"; EntityLength = 6; } break;
+			case '\'': if (bInAttribute) { Entity = "&apos;"; EntityLength = 6; } break;
+			default: break;
+		}
+
+		if (Entity != nullptr)
+		{
+			Append(Run, Pos - Run);
+			Append(Entity, EntityLength);
+			Run = Pos + 1;
+		}
+	}
+
+	Append(Run, End - Run);
+}
+
+void FNDIMetadataWriter::AppendNumbers(const double* Values, int32 NumValues)
+{
+	for (int32 i = 0; i < NumValues; ++i)
+	{
+		if (i > 0)
+			Append(',');
+
+		// 17 significant digits read back as the same double
+		ANSICHAR Number[32];
+		const int32 NumberLength = FCStringAnsi::Snprintf(Number, sizeof(Number), "%.17g", Values[i]);
+		Append(Number, NumberLength);
+	}
+}
+
+void FNDIMetadataWriter::BeginAttribute(FAnsiStringView Name)
+{
+	check(bIsStartTagOpen);
+
+	Append(' ');
+	Append(Name.GetData(), Name.Len());
+	Append("=\"", 2);
+}
+
+void FNDIMetadataWriter::EndAttribute()
+{
+	Append('"');
+}
+
+void FNDIMetadataWriter::BeginContent()
+{
+	if (bIsStartTagOpen)
+	{
+		Append('>');
+		bIsStartTagOpen = false;
+	}
+}
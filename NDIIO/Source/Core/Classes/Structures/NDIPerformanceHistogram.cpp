@@ -0,0 +1,96 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDIPerformanceHistogram.h>
+
+/** Constructs a new instance of this object */
+FNDIPerformanceHistogram::FNDIPerformanceHistogram()
+{
+	Buckets.SetNumZeroed(NumBuckets);
+}
+
+/** Compares this object to 'other' and returns a determination of whether they are equal */
+bool FNDIPerformanceHistogram::operator==(const FNDIPerformanceHistogram& other) const
+{
+	return this->Count == other.Count && this->Min == other.Min && this->Max == other.Max &&
+		   this->Mean == other.Mean && this->Buckets == other.Buckets;
+}
+
+/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+bool FNDIPerformanceHistogram::operator!=(const FNDIPerformanceHistogram& other) const
+{
+	return !(*this == other);
+}
+
+/** Adds a sample to the histogram */
+void FNDIPerformanceHistogram::Add(double Value)
+{
+	Value = FMath::Max(Value, 0.0);
+
+	int32 Bucket = 0;
+	if (Value >= 1.0)
+		Bucket = FMath::Min(int32(FMath::FloorLog2_64(uint64(FMath::Min(Value, 9.0e18)))) + 1, NumBuckets - 1);
+
+	// Structures deserialized from an older version may have fewer buckets
+	if (Buckets.Num() != NumBuckets)
+		Buckets.SetNumZeroed(NumBuckets);
+
+	++Buckets[Bucket];
+
+	Min = (Count == 0) ? float(Value) : FMath::Min(Min, float(Value));
+	Max = (Count == 0) ? float(Value) : FMath::Max(Max, float(Value));
+
+	++Count;
+	Sum += Value;
+	Mean = float(Sum / Count);
+}
+
+/** Returns the upper bound of the bucket the given percentile (0 to 100) of the samples falls in */
+float FNDIPerformanceHistogram::GetPercentile(float Percentile) const
+{
+	if (Count == 0)
+		return 0.f;
+
+	const int64 Rank = FMath::Max<int64>(1, FMath::CeilToInt64(Count * FMath::Clamp(Percentile, 0.f, 100.f) / 100.0));
+
+	int64 Samples = 0;
+	for (int32 Bucket = 0; Bucket < Buckets.Num(); ++Bucket)
+	{
+		Samples += Buckets[Bucket];
+		if (Samples >= Rank)
+			return FMath::Min(float(uint64(1) << Bucket), Max);
+	}
+
+	return Max;
+}
+
+/** Resets the current parameters to the default property values, keeping the buckets allocated */
+void FNDIPerformanceHistogram::Reset()
+{
+	Buckets.SetNumZeroed(NumBuckets);
+	FMemory::Memzero(Buckets.GetData(), Buckets.Num() * sizeof(int64));
+
+	Count = 0;
+	Min = 0.f;
+	Max = 0.f;
+	Mean = 0.f;
+	Sum = 0.0;
+}
+
+/** Attempts to serialize this object using an Archive object */
+FArchive& FNDIPerformanceHistogram::Serialize(FArchive& Ar)
+{
+	// we want to make sure that we are able to serialize this object, over many different version of this structure
+	int32 current_version = 0;
+
+	Ar << current_version << this->Buckets << this->Count << this->Min << this->Max << this->Sum;
+
+	if (Ar.IsLoading())
+		Mean = (Count > 0) ? float(Sum / Count) : 0.f;
+
+	return Ar;
+}
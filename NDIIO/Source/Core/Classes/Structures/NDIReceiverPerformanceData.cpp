@@ -17,6 +17,16 @@ FNDIReceiverPerformanceData::FNDIReceiverPerformanceData(const FNDIReceiverPerfo
 	this->DroppedVideoFrames = other.DroppedVideoFrames;
 	this->MetadataFrames = other.MetadataFrames;
 	this->VideoFrames = other.VideoFrames;
+	this->QueuedVideoFrames = other.QueuedVideoFrames;
+	this->QueuedAudioFrames = other.QueuedAudioFrames;
+	this->QueuedMetadataFrames = other.QueuedMetadataFrames;
+	this->ConnectionUptime = other.ConnectionUptime;
+	this->DecodedVideoDataRate = other.DecodedVideoDataRate;
+	this->ArrivalJitter = other.ArrivalJitter;
+	this->Latency = other.Latency;
+	this->VideoQueueDepth = other.VideoQueueDepth;
+	this->AudioQueueDepth = other.AudioQueueDepth;
+	this->DecodedVideoDataRates = other.DecodedVideoDataRates;
 }
 
 /** Copies existing instance properties to this object */
@@ -29,6 +39,16 @@ FNDIReceiverPerformanceData& FNDIReceiverPerformanceData::operator=(const FNDIRe
 	this->DroppedVideoFrames = other.DroppedVideoFrames;
 	this->MetadataFrames = other.MetadataFrames;
 	this->VideoFrames = other.VideoFrames;
+	this->QueuedVideoFrames = other.QueuedVideoFrames;
+	this->QueuedAudioFrames = other.QueuedAudioFrames;
+	this->QueuedMetadataFrames = other.QueuedMetadataFrames;
+	this->ConnectionUptime = other.ConnectionUptime;
+	this->DecodedVideoDataRate = other.DecodedVideoDataRate;
+	this->ArrivalJitter = other.ArrivalJitter;
+	this->Latency = other.Latency;
+	this->VideoQueueDepth = other.VideoQueueDepth;
+	this->AudioQueueDepth = other.AudioQueueDepth;
+	this->DecodedVideoDataRates = other.DecodedVideoDataRates;
 
 	// return the result of the copy
 	return *this;
@@ -41,7 +61,13 @@ bool FNDIReceiverPerformanceData::operator==(const FNDIReceiverPerformanceData&
 	return this->AudioFrames == other.AudioFrames && this->DroppedAudioFrames == other.DroppedAudioFrames &&
 		   this->DroppedMetadataFrames == other.DroppedMetadataFrames &&
 		   this->DroppedVideoFrames == other.DroppedVideoFrames && this->MetadataFrames == other.MetadataFrames &&
-		   this->VideoFrames == other.VideoFrames;
+		   this->VideoFrames == other.VideoFrames && this->QueuedVideoFrames == other.QueuedVideoFrames &&
+		   this->QueuedAudioFrames == other.QueuedAudioFrames &&
+		   this->QueuedMetadataFrames == other.QueuedMetadataFrames &&
+		   this->ConnectionUptime == other.ConnectionUptime && this->DecodedVideoDataRate == other.DecodedVideoDataRate &&
+		   this->ArrivalJitter == other.ArrivalJitter && this->Latency == other.Latency &&
+		   this->VideoQueueDepth == other.VideoQueueDepth && this->AudioQueueDepth == other.AudioQueueDepth &&
+		   this->DecodedVideoDataRates == other.DecodedVideoDataRates;
 }
 
 /** Resets the current parameters to the default property values */
@@ -54,17 +80,37 @@ void FNDIReceiverPerformanceData::Reset()
 	this->DroppedVideoFrames = 0;
 	this->MetadataFrames = 0;
 	this->VideoFrames = 0;
+	this->QueuedVideoFrames = 0;
+	this->QueuedAudioFrames = 0;
+	this->QueuedMetadataFrames = 0;
+	this->ConnectionUptime = 0.f;
+	this->DecodedVideoDataRate = 0.f;
+	this->ArrivalJitter.Reset();
+	this->Latency.Reset();
+	this->VideoQueueDepth.Reset();
+	this->AudioQueueDepth.Reset();
+	this->DecodedVideoDataRates.Reset();
 }
 
 /** Attempts to serialize this object using an Archive object */
 FArchive& FNDIReceiverPerformanceData::Serialize(FArchive& Ar)
 {
 	// we want to make sure that we are able to serialize this object, over many different version of this structure
-	int32 current_version = 0;
+	int32 current_version = 1;
 
 	// serialize this structure
-	return Ar << current_version << this->AudioFrames << this->DroppedAudioFrames << this->DroppedMetadataFrames
-			  << this->DroppedVideoFrames << this->MetadataFrames << this->VideoFrames;
+	Ar << current_version << this->AudioFrames << this->DroppedAudioFrames << this->DroppedMetadataFrames
+	   << this->DroppedVideoFrames << this->MetadataFrames << this->VideoFrames;
+
+	// version 1 added the queue depths, uptime, decoded video data rate and histograms
+	if (current_version >= 1)
+	{
+		Ar << this->QueuedVideoFrames << this->QueuedAudioFrames << this->QueuedMetadataFrames
+		   << this->ConnectionUptime << this->DecodedVideoDataRate << this->ArrivalJitter << this->Latency
+		   << this->VideoQueueDepth << this->AudioQueueDepth << this->DecodedVideoDataRates;
+	}
+
+	return Ar;
 }
 
 /** Compares this object to 'other" and returns a determination of whether they are NOT equal */
@@ -0,0 +1,68 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDISenderPerformanceData.h>
+
+/** Compares this object to 'other' and returns a determination of whether they are equal */
+bool FNDISenderPerformanceData::operator==(const FNDISenderPerformanceData& other) const
+{
+	// return the value of a deep compare against the 'other' structure
+	return this->VideoFrames == other.VideoFrames &&
+		   this->VideoFramesSkippedNoConnections == other.VideoFramesSkippedNoConnections &&
+		   this->VideoFramesSkippedSameTimecode == other.VideoFramesSkippedSameTimecode &&
+		   this->VideoFramesSkippedChangingBroadcastSize == other.VideoFramesSkippedChangingBroadcastSize &&
+		   this->VideoFramesSkippedNoRenderTarget == other.VideoFramesSkippedNoRenderTarget &&
+		   this->AudioFrames == other.AudioFrames &&
+		   this->AudioFramesSkippedNoConnections == other.AudioFramesSkippedNoConnections &&
+		   this->AudioFramesSkippedChangingBroadcastSize == other.AudioFramesSkippedChangingBroadcastSize &&
+		   this->AudioFramesSkippedBusy == other.AudioFramesSkippedBusy &&
+		   this->DrawTime == other.DrawTime && this->ResolveTime == other.ResolveTime &&
+		   this->MapTime == other.MapTime && this->VideoSendTime == other.VideoSendTime &&
+		   this->AudioConvertTime == other.AudioConvertTime && this->AudioSendTime == other.AudioSendTime;
+}
+
+/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+bool FNDISenderPerformanceData::operator!=(const FNDISenderPerformanceData& other) const
+{
+	return !(*this == other);
+}
+
+/** Resets the current parameters to the default property values */
+void FNDISenderPerformanceData::Reset()
+{
+	// Ensure we reset all the properties of this object to nominal default properties
+	this->VideoFrames = 0;
+	this->VideoFramesSkippedNoConnections = 0;
+	this->VideoFramesSkippedSameTimecode = 0;
+	this->VideoFramesSkippedChangingBroadcastSize = 0;
+	this->VideoFramesSkippedNoRenderTarget = 0;
+	this->AudioFrames = 0;
+	this->AudioFramesSkippedNoConnections = 0;
+	this->AudioFramesSkippedChangingBroadcastSize = 0;
+	this->AudioFramesSkippedBusy = 0;
+
+	this->DrawTime.Reset();
+	this->ResolveTime.Reset();
+	this->MapTime.Reset();
+	this->VideoSendTime.Reset();
+	this->AudioConvertTime.Reset();
+	this->AudioSendTime.Reset();
+}
+
+/** Attempts to serialize this object using an Archive object */
+FArchive& FNDISenderPerformanceData::Serialize(FArchive& Ar)
+{
+	// we want to make sure that we are able to serialize this object, over many different version of this structure
+	int32 current_version = 0;
+
+	// serialize this structure
+	return Ar << current_version << this->VideoFrames << this->VideoFramesSkippedNoConnections
+			  << this->VideoFramesSkippedSameTimecode << this->VideoFramesSkippedChangingBroadcastSize
+			  << this->VideoFramesSkippedNoRenderTarget << this->AudioFrames << this->AudioFramesSkippedNoConnections
+			  << this->AudioFramesSkippedChangingBroadcastSize << this->AudioFramesSkippedBusy << this->DrawTime
+			  << this->ResolveTime << this->MapTime << this->VideoSendTime << this->AudioConvertTime << this->AudioSendTime;
+}
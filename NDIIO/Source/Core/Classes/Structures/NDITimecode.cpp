@@ -0,0 +1,107 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDITimecode.h>
+
+
+FNDITimecodeConverter::FNDITimecodeConverter()
+	: FNDITimecodeConverter(FFrameRate(60, 1))
+{}
+
+FNDITimecodeConverter::FNDITimecodeConverter(const FFrameRate& InFrameRate)
+	: FrameRate(0, 0)
+{
+	SetFrameRate(InFrameRate);
+}
+
+void FNDITimecodeConverter::SetFrameRate(const FFrameRate& InFrameRate)
+{
+	if ((InFrameRate == FrameRate) && (TimecodeRate > 0))
+		return;
+
+	FrameRate = InFrameRate;
+
+	if ((FrameRate.Numerator <= 0) || (FrameRate.Denominator <= 0))
+	{
+		TimecodeRate = 0;
+		DropFramesPerMinute = 0;
+		FramesPerMinute = 0;
+		FramesPerTenMinutes = 0;
+		FramesPerDay = 0;
+		return;
+	}
+
+	TimecodeRate = (int64(FrameRate.Numerator) + FrameRate.Denominator - 1) / FrameRate.Denominator;
+
+	// 29.97 drops 2 frame numbers every minute but every tenth, 59.94 drops 4
+	DropFramesPerMinute = FTimecode::IsDropFormatTimecodeSupported(FrameRate) ? (TimecodeRate / 15) : 0;
+
+	FramesPerMinute = (TimecodeRate * 60) - DropFramesPerMinute;
+	FramesPerTenMinutes = (FramesPerMinute * 10) + DropFramesPerMinute;
+	FramesPerDay = FramesPerTenMinutes * 6 * 24;
+}
+
+int64 FNDITimecodeConverter::FrameNumberFromTicks(int64 Ticks) const
+{
+	if (TimecodeRate <= 0)
+		return 0;
+
+	Ticks %= TicksPerDay;
+	if (Ticks < 0)
+		Ticks += TicksPerDay;
+
+	// Ticks within a day times the numerator of any real frame rate stays within 64 bits
+	const int64 FrameNumber = (Ticks * FrameRate.Numerator) / (TicksPerSecond * FrameRate.Denominator);
+
+	return FrameNumber % FramesPerDay;
+}
+
+FTimecode FNDITimecodeConverter::FromTicks(int64 Ticks) const
+{
+	return FromFrameNumber(FrameNumberFromTicks(Ticks));
+}
+
+FTimecode FNDITimecodeConverter::FromFrameNumber(int64 FrameNumber) const
+{
+	if (TimecodeRate <= 0)
+		return FTimecode();
+
+	FrameNumber %= FramesPerDay;
+	if (FrameNumber < 0)
+		FrameNumber += FramesPerDay;
+
+	// Skip the dropped frame numbers, so that the frames can be counted at the timecode rate
+	if (DropFramesPerMinute > 0)
+	{
+		const int64 TenMinutes = FrameNumber / FramesPerTenMinutes;
+		const int64 Remainder = FrameNumber % FramesPerTenMinutes;
+
+		FrameNumber += DropFramesPerMinute * 9 * TenMinutes;
+		if (Remainder > DropFramesPerMinute)
+			FrameNumber += DropFramesPerMinute * ((Remainder - DropFramesPerMinute) / FramesPerMinute);
+	}
+
+	const int64 Frames = FrameNumber % TimecodeRate;
+	const int64 TotalSeconds = FrameNumber / TimecodeRate;
+
+	return FTimecode(int32((TotalSeconds / 3600) % 24), int32((TotalSeconds / 60) % 60), int32(TotalSeconds % 60),
+	                 int32(Frames), DropFramesPerMinute > 0);
+}
+
+int64 FNDITimecodeConverter::ToFrameNumber(const FTimecode& Timecode) const
+{
+	if (TimecodeRate <= 0)
+		return 0;
+
+	const int64 TotalMinutes = (int64(Timecode.Hours) * 60) + Timecode.Minutes;
+
+	int64 FrameNumber = (((TotalMinutes * 60) + Timecode.Seconds) * TimecodeRate) + Timecode.Frames;
+	if (DropFramesPerMinute > 0)
+		FrameNumber -= DropFramesPerMinute * (TotalMinutes - (TotalMinutes / 10));
+
+	return FrameNumber;
+}
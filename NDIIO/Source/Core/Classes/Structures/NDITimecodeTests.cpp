@@ -0,0 +1,109 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDITimecode.h>
+
+#include <HAL/PlatformTime.h>
+#include <Misc/AutomationTest.h>
+#include <Misc/EngineVersionComparison.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#define NDIIO_TIMECODE_TEST_FLAGS (EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+#else
+#define NDIIO_TIMECODE_TEST_FLAGS (EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+#endif
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNDITimecodeConverterTest, "NDIIO.Timecode.Converter", NDIIO_TIMECODE_TEST_FLAGS)
+
+bool FNDITimecodeConverterTest::RunTest(const FString& Parameters)
+{
+	/** The ticks in the middle of a frame, away from where rounding could move it to a neighbouring frame */
+	auto TicksOfFrame = [](int64 FrameNumber, const FFrameRate& FrameRate)
+	{
+		return ((FrameNumber * 2 + 1) * FNDITimecodeConverter::TicksPerSecond * FrameRate.Denominator) / (2 * int64(FrameRate.Numerator));
+	};
+
+	for (const FFrameRate& FrameRate : { FFrameRate(30000, 1001), FFrameRate(60000, 1001) })
+	{
+		const FNDITimecodeConverter Converter(FrameRate);
+		const int32 TimecodeRate = FMath::RoundToInt(FrameRate.AsDecimal());
+
+		TestTrue(FString::Printf(TEXT("%s is drop-frame"), *FrameRate.ToPrettyText().ToString()), Converter.IsDropFrame());
+
+		// The frame after the last of a minute skips the dropped frame numbers, but not at every tenth minute
+		const int64 FirstMinute = Converter.ToFrameNumber(FTimecode(0, 0, 59, TimecodeRate - 1, true)) + 1;
+		TestEqual(TEXT("Frame after 00:00:59;xx"), Converter.FromFrameNumber(FirstMinute).ToString(),
+				  FTimecode(0, 1, 0, TimecodeRate / 15, true).ToString());
+
+		const int64 TenthMinute = Converter.ToFrameNumber(FTimecode(0, 9, 59, TimecodeRate - 1, true)) + 1;
+		TestEqual(TEXT("Frame after 00:09:59;xx"), Converter.FromFrameNumber(TenthMinute).ToString(),
+				  FTimecode(0, 10, 0, 0, true).ToString());
+
+		// The day rolls over after 23:59:59;xx
+		const int64 LastFrame = Converter.ToFrameNumber(FTimecode(23, 59, 59, TimecodeRate - 1, true));
+		TestEqual(TEXT("Last frame of the day"), Converter.FromFrameNumber(LastFrame).ToString(),
+				  FTimecode(23, 59, 59, TimecodeRate - 1, true).ToString());
+		TestEqual(TEXT("Frame after 23:59:59;xx"), Converter.FromFrameNumber(LastFrame + 1).ToString(),
+				  FTimecode(0, 0, 0, 0, true).ToString());
+
+		// Agree with the engine over the whole day, sampled at a step which lands on every frame within a minute
+		for (int64 FrameNumber = 0; FrameNumber <= LastFrame; FrameNumber += 997)
+		{
+			const FTimecode Expected = FTimecode::FromFrameNumber(FFrameNumber(int32(FrameNumber)), FrameRate, true);
+			const FTimecode Converted = Converter.FromFrameNumber(FrameNumber);
+
+			if (!TestEqual(FString::Printf(TEXT("Frame %lld at %s"), FrameNumber, *FrameRate.ToPrettyText().ToString()), Converted.ToString(), Expected.ToString()) ||
+				!TestEqual(TEXT("Frame number round trip"), Converter.ToFrameNumber(Converted), FrameNumber) ||
+				!TestEqual(TEXT("Frame from ticks"), Converter.FromTicks(TicksOfFrame(FrameNumber, FrameRate)).ToString(), Expected.ToString()))
+			{
+				break;
+			}
+		}
+	}
+
+	// Ticks roll over at 24 hours
+	{
+		const FNDITimecodeConverter Converter(FFrameRate(30, 1));
+
+		TestEqual(TEXT("Last tick of the day"), Converter.FromTicks(FNDITimecodeConverter::TicksPerDay - 1).ToString(),
+				  FTimecode(23, 59, 59, 29, false).ToString());
+		TestEqual(TEXT("First tick of the next day"), Converter.FromTicks(FNDITimecodeConverter::TicksPerDay).ToString(),
+				  FTimecode(0, 0, 0, 0, false).ToString());
+	}
+
+	// Compare against the conversion through floating point seconds, which this replaces
+	{
+		const FFrameRate FrameRate(60000, 1001);
+		const FNDITimecodeConverter Converter(FrameRate);
+
+		static constexpr int32 NumConversions = 1000000;
+		const int64 TickStep = FNDITimecodeConverter::TicksPerDay / NumConversions;
+
+		int64 Checksum = 0;
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumConversions; ++Index)
+			Checksum += Converter.FromTicks(Index * TickStep).Frames;
+		const double IntegerTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumConversions; ++Index)
+			Checksum += FTimecode::FromTimespan(FTimespan(Index * TickStep), FrameRate, true, true).Frames;
+		const double FloatTime = FPlatformTime::Seconds() - StartTime;
+
+		AddInfo(FString::Printf(TEXT("%d conversions at %s: %.2f ms with integers, %.2f ms through floating point (checksum %lld)"),
+								NumConversions, *FrameRate.ToPrettyText().ToString(), IntegerTime * 1000.0, FloatTime * 1000.0, Checksum));
+	}
+
+	return true;
+}
+
+#undef NDIIO_TIMECODE_TEST_FLAGS
+
+#endif
@@ -0,0 +1,296 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#include <Structures/NDIXml.h>
+
+
+static FORCEINLINE bool IsXmlSpace(ANSICHAR Char)
+{
+	return (Char == ' ') || (Char == '\t') || (Char == '\r') || (Char == '\n');
+}
+
+static FORCEINLINE bool IsXmlNameEnd(ANSICHAR Char)
+{
+	return IsXmlSpace(Char) || (Char == '/') || (Char == '>') || (Char == '=');
+}
+
+static bool StartsWith(const ANSICHAR* Pos, const ANSICHAR* End, const ANSICHAR* Token, int32 TokenLength)
+{
+	return ((End - Pos) >= TokenLength) && (FMemory::Memcmp(Pos, Token, TokenLength) == 0);
+}
+
+/** Returns the position just past the next occurrence of the token, or nullptr if there is none */
+static const ANSICHAR* SkipPast(const ANSICHAR* Pos, const ANSICHAR* End, const ANSICHAR* Token, int32 TokenLength)
+{
+	for (; (End - Pos) >= TokenLength; ++Pos)
+	{
+		if (FMemory::Memcmp(Pos, Token, TokenLength) == 0)
+			return Pos + TokenLength;
+	}
+
+	return nullptr;
+}
+
+static void AppendUtf8(TArray<ANSICHAR, TInlineAllocator<256> >& Buffer, uint32 CodePoint)
+{
+	if (CodePoint < 0x80)
+	{
+		Buffer.Add(static_cast<ANSICHAR>(CodePoint));
+	}
+	else if (CodePoint < 0x800)
+	{
+		Buffer.Add(static_cast<ANSICHAR>(0xC0 | (CodePoint >> 6)));
+		Buffer.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+	}
+	else if (CodePoint < 0x10000)
+	{
+		Buffer.Add(static_cast<ANSICHAR>(0xE0 | (CodePoint >> 12)));
+		Buffer.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+		Buffer.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+	}
+	else
+	{
+		Buffer.Add(static_cast<ANSICHAR>(0xF0 | (CodePoint >> 18)));
+		Buffer.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 12) & 0x3F)));
+		Buffer.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+		Buffer.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+	}
+}
+
+/** Decodes the entities of an attribute value into the buffer, which is left terminated */
+static bool DecodeEntities(FAnsiStringView Value, TArray<ANSICHAR, TInlineAllocator<256> >& Buffer)
+{
+	Buffer.Reset();
+
+	const ANSICHAR* Pos = Value.GetData();
+	const ANSICHAR* End = Pos + Value.Len();
+
+	while (Pos < End)
+	{
+		if (*Pos != '&')
+		{
+			Buffer.Add(*Pos++);
+			continue;
+		}
+
+		const ANSICHAR* EntityEnd = Pos + 1;
+		while ((EntityEnd < End) && (*EntityEnd != ';'))
+			++EntityEnd;
+		if (EntityEnd >= End)
+			return false;
+
+		const ANSICHAR* Entity = Pos + 1;
+		const int32 EntityLength = EntityEnd - Entity;
+
+		if (StartsWith(Entity, EntityEnd, "lt", 2) && (EntityLength == 2))
+			Buffer.Add('<');
+		else if (StartsWith(Entity, EntityEnd, "gt", 2) && (EntityLength == 2))
+			Buffer.Add('>');
+		else if (StartsWith(Entity, EntityEnd, "amp", 3) && (EntityLength == 3))
+			Buffer.Add('&');
+		else if (StartsWith(Entity, EntityEnd, "quot", 4) && (EntityLength == 4))
+			Buffer.Add('"');
+		else if (StartsWith(Entity, EntityEnd, "apos", 4) && (EntityLength == 4))
+			Buffer.Add('\'');
+		else if ((EntityLength > 1) && (Entity[0] == '#'))
+		{
+			const bool bHex = (Entity[1] == 'x') || (Entity[1] == 'X');
+			uint32 CodePoint = 0;
+			for (const ANSICHAR* Digit = Entity + (bHex ? 2 : 1); Digit < EntityEnd; ++Digit)
+			{
+				if ((*Digit >= '0') && (*Digit <= '9'))
+					CodePoint = CodePoint * (bHex ? 16 : 10) + (*Digit - '0');
+				else if (bHex && (*Digit >= 'a') && (*Digit <= 'f'))
+					CodePoint = CodePoint * 16 + (*Digit - 'a' + 10);
+				else if (bHex && (*Digit >= 'A') && (*Digit <= 'F'))
+					CodePoint = CodePoint * 16 + (*Digit - 'A' + 10);
+				else
+					return false;
+
+				if (CodePoint > 0x10FFFF)
+					return false;
+			}
+			AppendUtf8(Buffer, CodePoint);
+		}
+		else
+		{
+			return false;
+		}
+
+		Pos = EntityEnd + 1;
+	}
+
+	Buffer.Add('\0');
+
+	return true;
+}
+
+
+bool NDIXmlParser::ParseUtf8(const ANSICHAR* Data, int32 Length)
+{
+	Utf8ParserStack.Reset();
+
+	if ((Data == nullptr) || (Length <= 0))
+		return false;
+
+	const ANSICHAR* Pos = Data;
+	const ANSICHAR* End = Data + Length;
+
+	// The length of NDI metadata frames may include the terminator
+	while ((End > Pos) && (End[-1] == '\0'))
+		--End;
+
+	while (Pos < End)
+	{
+		while ((Pos < End) && (*Pos != '<'))
+			++Pos;
+		if (++Pos >= End)
+			break;
+
+		// Declarations, comments and CDATA are skipped
+		if (*Pos == '?')
+		{
+			Pos = SkipPast(Pos, End, "?>", 2);
+			if (Pos == nullptr)
+				return false;
+			continue;
+		}
+		if (*Pos == '!')
+		{
+			if (StartsWith(Pos, End, "!--", 3))
+				Pos = SkipPast(Pos + 3, End, "-->", 3);
+			else if (StartsWith(Pos, End, "![CDATA[", 8))
+				Pos = SkipPast(Pos + 8, End, "]]>", 3);
+			else
+				Pos = SkipPast(Pos, End, ">", 1);
+			if (Pos == nullptr)
+				return false;
+			continue;
+		}
+
+		const bool bClosingTag = (*Pos == '/');
+		if (bClosingTag)
+			++Pos;
+
+		const ANSICHAR* NameStart = Pos;
+		while ((Pos < End) && !IsXmlNameEnd(*Pos))
+			++Pos;
+		if (Pos == NameStart)
+			return false;
+
+		const FAnsiStringView ElementName(NameStart, Pos - NameStart);
+		const uint32 ElementHash = NDIXmlHash(ElementName);
+
+		if (bClosingTag)
+		{
+			Pos = SkipPast(Pos, End, ">", 1);
+			if (Pos == nullptr)
+				return false;
+
+			if (Utf8ParserStack.Num() > 0)
+			{
+				NDIXmlElementParser* Parser = Utf8ParserStack.Pop();
+				if (!Parser->ProcessCloseUtf8(ElementHash, ElementName))
+					return false;
+			}
+			continue;
+		}
+
+		NDIXmlElementParser* Parser = nullptr;
+		if (Utf8ParserStack.Num() == 0)
+		{
+			TSharedRef<NDIXmlElementParser>* ParserPtr = ElementParsersByHash.Find(ElementHash);
+			if (ParserPtr != nullptr)
+				Parser = &ParserPtr->Get();
+		}
+		else
+		{
+			Parser = Utf8ParserStack.Last()->ProcessElementUtf8(ElementHash, ElementName);
+		}
+		if (Parser == nullptr)
+			Parser = &NullParser.Get();
+
+		if (!Parser->ProcessOpenUtf8(ElementHash, ElementName))
+			return false;
+
+		bool bSelfClosing = false;
+		for (;;)
+		{
+			while ((Pos < End) && IsXmlSpace(*Pos))
+				++Pos;
+			if (Pos >= End)
+				return false;
+
+			if (*Pos == '>')
+			{
+				++Pos;
+				break;
+			}
+			if (*Pos == '/')
+			{
+				if (((Pos + 1) >= End) || (Pos[1] != '>'))
+					return false;
+				Pos += 2;
+				bSelfClosing = true;
+				break;
+			}
+
+			const ANSICHAR* AttributeStart = Pos;
+			while ((Pos < End) && !IsXmlNameEnd(*Pos))
+				++Pos;
+			if (Pos == AttributeStart)
+				return false;
+			const FAnsiStringView AttributeName(AttributeStart, Pos - AttributeStart);
+
+			while ((Pos < End) && IsXmlSpace(*Pos))
+				++Pos;
+			if ((Pos >= End) || (*Pos != '='))
+				return false;
+			++Pos;
+			while ((Pos < End) && IsXmlSpace(*Pos))
+				++Pos;
+			if ((Pos >= End) || ((*Pos != '"') && (*Pos != '\'')))
+				return false;
+
+			const ANSICHAR Quote = *Pos++;
+			const ANSICHAR* ValueStart = Pos;
+			bool bHasEntities = false;
+			while ((Pos < End) && (*Pos != Quote))
+			{
+				bHasEntities |= (*Pos == '&');
+				++Pos;
+			}
+			if (Pos >= End)
+				return false;
+
+			FAnsiStringView AttributeValue(ValueStart, Pos - ValueStart);
+			++Pos;
+
+			if (bHasEntities)
+			{
+				if (!DecodeEntities(AttributeValue, Utf8ValueBuffer))
+					return false;
+				AttributeValue = FAnsiStringView(Utf8ValueBuffer.GetData(), Utf8ValueBuffer.Num() - 1);
+			}
+
+			if (!Parser->ProcessAttributeUtf8(NDIXmlHash(AttributeName), AttributeName, AttributeValue))
+				return false;
+		}
+
+		if (bSelfClosing)
+		{
+			if (!Parser->ProcessCloseUtf8(ElementHash, ElementName))
+				return false;
+		}
+		else
+		{
+			Utf8ParserStack.Push(Parser);
+		}
+	}
+
+	return true;
+}
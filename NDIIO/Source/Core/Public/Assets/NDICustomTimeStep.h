@@ -0,0 +1,121 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <GenlockedCustomTimeStep.h>
+
+#include <Objects/Media/NDIMediaReceiver.h>
+
+#include "NDICustomTimeStep.generated.h"
+
+
+/**
+	Custom time step which paces the engine to the arrival of video frames from an NDI source
+*/
+UCLASS(Blueprintable, editinlinenew, meta=(DisplayName="NDI Custom Time Step"))
+class NDIIO_API UNDICustomTimeStep : public UGenlockedCustomTimeStep
+{
+	GENERATED_UCLASS_BODY()
+
+private:
+	/** The Receiver object whose video frames the engine is locked to */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "NDI IO",
+			  META = (DisplayName = "NDI Media Source", AllowPrivateAccess = true))
+	UNDIMediaReceiver* NDIMediaSource = nullptr;
+
+	/** The number of frame periods to wait for a new video frame before the source is considered to have dropped out */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "NDI IO",
+			  META = (DisplayName = "Dropout Timeout (frames)", ClampMin = "1.0", AllowPrivateAccess = true))
+	float DropoutTimeout = 2.5f;
+
+	/** The frame rate used to pace the engine before a video frame has been received from the source */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "NDI IO",
+			  META = (DisplayName = "Fallback Frame Rate", AllowPrivateAccess = true))
+	FFrameRate FallbackFrameRate = FFrameRate(60, 1);
+
+	/** While the source has dropped out, keep ticking the engine at the last known source frame rate
+	    instead of letting the engine run at its own rate */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "NDI IO",
+			  META = (DisplayName = "Keep Source Rate on Dropout", AllowPrivateAccess = true))
+	bool bKeepSourceRateOnDropout = true;
+
+	/** The number of source frames the engine was locked to */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Synced Frames", AllowPrivateAccess = true))
+	int64 SyncedFrames = 0;
+
+	/** The number of source frames which arrived while the engine was busy, and were skipped over */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Missed Frames", AllowPrivateAccess = true))
+	int64 MissedFrames = 0;
+
+	/** The number of times the source stopped delivering frames while the engine was locked to it */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Dropouts", AllowPrivateAccess = true))
+	int64 Dropouts = 0;
+
+	/** The average difference (in milliseconds) between the local and the source frame intervals */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Average Interval Error (ms)", AllowPrivateAccess = true))
+	float AverageIntervalError = 0.f;
+
+	/** The largest difference (in milliseconds) between the local and the source frame intervals */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Maximum Interval Error (ms)", AllowPrivateAccess = true))
+	float MaximumIntervalError = 0.f;
+
+	/** How far (in milliseconds) the local clock has drifted from the source clock since the engine locked to it */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Drift (ms)", AllowPrivateAccess = true))
+	float Drift = 0.f;
+
+public:
+	//~ UFixedFrameRateCustomTimeStep interface
+	virtual FFrameRate GetFixedFrameRate() const override;
+
+	//~ UEngineCustomTimeStep interface
+	virtual bool Initialize(class UEngine* InEngine) override;
+	virtual void Shutdown(class UEngine* InEngine) override;
+	virtual bool UpdateTimeStep(class UEngine* InEngine) override;
+	virtual ECustomTimeStepSynchronizationState GetSynchronizationState() const override;
+
+	//~ UGenlockedCustomTimeStep interface
+	virtual uint32 GetLastSyncCountDelta() const override;
+	virtual bool IsLastSyncDataValid() const override;
+	virtual bool WaitForSync() override;
+
+	//~ UObject interface
+	virtual void BeginDestroy() override;
+
+	/** Resets the drift and frame statistics */
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Reset Statistics"))
+	void ResetStatistics();
+
+private:
+	void OnFrameArrived(int64 Timestamp, const FFrameRate& Rate, double ArrivalTime);
+	void OnDropout();
+
+	void ReleaseResources();
+
+private:
+	FDelegateHandle ConnectedEventHandle;
+	FDelegateHandle DisconnectedEventHandle;
+
+	ECustomTimeStepSynchronizationState State = ECustomTimeStepSynchronizationState::Closed;
+
+	FFrameRate SourceFrameRate = FFrameRate(0, 1);
+
+	bool bIsLastSyncDataValid = false;
+	uint32 LastSyncCountDelta = 1;
+	int64 LastSyncTimestamp = 0;
+	double LastSyncTime = 0.0;
+	double LastWaitEndTime = 0.0;
+
+	int64 LockSourceTimestamp = 0;
+	double LockTime = 0.0;
+};
@@ -10,6 +10,9 @@
 #include <GenlockedTimecodeProvider.h>
 
 #include <Objects/Media/NDIMediaReceiver.h>
+#include <Structures/NDITimecode.h>
+
+#include <atomic>
 
 #include "NDITimecodeProvider.generated.h"
 
@@ -28,6 +31,16 @@ private:
 			  META = (DisplayName = "NDI Media Source", AllowPrivateAccess = true))
 	UNDIMediaReceiver* NDIMediaSource = nullptr;
 
+	/** Whether the timecode is extrapolated between the frames received, from the measured frame interval */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "NDI IO",
+			  META = (DisplayName = "Extrapolate Timecode", AllowPrivateAccess = true))
+	bool bExtrapolateTimecode = true;
+
+	/** The time without frames, in seconds, after which the source is considered stalled and no longer synchronized */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "NDI IO",
+			  META = (DisplayName = "Stall Timeout", ClampMin = 0.0, Units = "s", AllowPrivateAccess = true))
+	float StallTimeout = 0.5f;
+
 public:
 	//~ UTimecodeProvider interface
 	virtual bool FetchTimecode(FQualifiedFrameTime& OutFrameTime) override;
@@ -46,7 +59,32 @@ private:
 	FDelegateHandle ConnectedEventHandle;
 	FDelegateHandle DisconnectedEventHandle;
 
-	mutable FCriticalSection StateSyncContext;
-	ETimecodeProviderSynchronizationState State = ETimecodeProviderSynchronizationState::Closed;
-	FQualifiedFrameTime MostRecentFrameTime;
+	/** The state published by the receiver events, and read by the timecode queries */
+	struct FTimecodeSnapshot
+	{
+		ETimecodeProviderSynchronizationState State = ETimecodeProviderSynchronizationState::Closed;
+		FQualifiedFrameTime FrameTime;
+
+		/** The time the most recent frame was received, in FPlatformTime seconds */
+		double ArrivalTime = 0.0;
+
+		/** The smoothed interval between the frames received, in seconds */
+		double FrameInterval = 0.0;
+	};
+
+	void PublishSnapshot(const FTimecodeSnapshot& Snapshot);
+	FTimecodeSnapshot ReadSnapshot() const;
+
+private:
+	/**
+		The snapshot is published through a sequence lock: writers, serialized by the sync context, make the
+		sequence odd while they update the snapshot, and readers retry if the sequence was odd or changed while
+		they copied it. Queries never take a lock, nor contend with the thread receiving the frames.
+	*/
+	FCriticalSection StateSyncContext;
+	std::atomic<uint32> SnapshotSequence { 0 };
+	FTimecodeSnapshot Snapshot;
+
+	/** Used by the writers, under the sync context */
+	FNDITimecodeConverter TimecodeConverter;
 };
@@ -91,6 +91,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Get Number of Connections"))
 	void GetNumberOfConnections(int32& Result);
 
+	/**
+		Returns the current performance data of the sender
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Get Performance Data"))
+	FNDISenderPerformanceData GetPerformanceData() const;
+
 	/**
 		Attempts to immediately stop sending frames over NDI to any connected receivers
 	*/
@@ -11,6 +11,7 @@
 
 #include <Components/ActorComponent.h>
 #include <Structures/NDIConnectionInformation.h>
+#include <Structures/NDIDiscoveryScope.h>
 
 #include "NDIFinderComponent.generated.h"
 
@@ -36,6 +37,18 @@ public:
 	UPROPERTY()
 	TArray<FNDIConnectionInformation> NetworkSourceCollection;
 
+	/**
+		Whether this component discovers sources within its own scope, rather than using the sources discovered
+		within the scope of the plugin settings
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Discovery", META = (DisplayName = "Use Own Discovery Scope"))
+	bool bUseOwnDiscoveryScope = false;
+
+	/** The scope within which this component discovers sources, when it uses its own */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Discovery",
+			  META = (DisplayName = "Discovery Scope", EditCondition = "bUseOwnDiscoveryScope"))
+	FNDIDiscoveryScope DiscoveryScope;
+
 	/** A delegate which is broadcast when any change to the network source collection has been detected */
 	UPROPERTY(BlueprintAssignable, META = (DisplayName = "On Network Sources Changed", AllowPrivateAccess = true))
 	FNDIFinderServiceCollectionChangedDelegate OnNetworkSourcesChanged;
@@ -74,6 +87,16 @@ private:
 	UFUNCTION()
 	virtual void OnNetworkSourceCollectionChangedEvent() final;
 
+	/** Applies the changes the NDI Finder Service notifies listeners of to the network source collection */
+	void OnNetworkSourceCollectionDelta(const struct FNDISourceCollectionDelta& Delta);
+
 private:
 	FCriticalSection CollectionSyncContext;
+
+	/** The generation of the finder service's collection which 'NetworkSourceCollection' was last updated to */
+	uint64 NetworkSourceGeneration = 0;
+
+	/** The finder service discovering within this component's own scope, if it uses one */
+	TSharedPtr<class FNDIFinderService> ScopedFinderService;
+	FDelegateHandle ScopedSourceCollectionDeltaHandle;
 };
\ No newline at end of file
@@ -44,6 +44,33 @@ struct NDIIO_API FPTZState
 };
 
 
+/**
+	Statistics of the PTZ commands received by a PTZ controller. Speed and focus commands received within a frame
+	are coalesced, so that only the latest one of each is applied and the earlier ones are dropped.
+*/
+USTRUCT(BlueprintType, Blueprintable, Category = "NDI IO", META = (DisplayName = "NDI PTZ Command Stats"))
+struct NDIIO_API FPTZCommandStats
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** The number of PTZ commands received */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "PTZ")
+	int64 ReceivedCommands = 0;
+
+	/** The number of PTZ commands applied */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "PTZ")
+	int64 AppliedCommands = 0;
+
+	/** The number of PTZ commands dropped, as a later command of the same kind was received within the frame */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "PTZ")
+	int64 DroppedCommands = 0;
+
+	/** The number of PTZ commands received per second, over the last second */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "PTZ")
+	float CommandRate = 0.f;
+};
+
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FNDIEventDelegate_OnPTZPanTiltSpeed, float, PanSpeed, float, TiltSpeed);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNDIEventDelegate_OnPTZZoomSpeed, float, ZoomSpeed);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FNDIEventDelegate_OnPTZFocus, bool, AutoMode, float, Distance);
@@ -107,11 +134,12 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(DisplayName="Preset Recall Easing", UIMin="0", UIMax="60", AllowPrivateAccess = true), Category="PTZ")
 	float PTZRecallEasing = 2.f;
 
-	UPROPERTY(BlueprintReadWrite, meta=(AllowPrivateAccess = true), Category="PTZ")
+	/** The controller only ticks while the camera is moving, so the speeds are set through their setters */
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = "SetPanSpeed", meta=(AllowPrivateAccess = true), Category="PTZ")
 	float PTZPanSpeed = 0.f;
-	UPROPERTY(BlueprintReadWrite, meta=(AllowPrivateAccess = true), Category="PTZ")
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = "SetTiltSpeed", meta=(AllowPrivateAccess = true), Category="PTZ")
 	float PTZTiltSpeed = 0.f;
-	UPROPERTY(BlueprintReadWrite, meta=(AllowPrivateAccess = true), Category="PTZ")
+	UPROPERTY(BlueprintReadWrite, BlueprintSetter = "SetZoomSpeed", meta=(AllowPrivateAccess = true), Category="PTZ")
 	float PTZZoomSpeed = 0.f;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(DisplayName="PTZ Presets", AllowPrivateAccess = true), Category="PTZ")
@@ -136,6 +164,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Receive Metadata From Sender"))
 	void ReceiveMetaDataFromSender(UNDIMediaSender* Sender, FString Data);
 
+	/** Call with the UTF-8 PTZ metadata received from an NDI media sender, which is parsed in place */
+	void ReceiveMetaDataUtf8FromSender(UNDIMediaSender* Sender, const ANSICHAR* Data, int32 Length);
+
 public:
 	UPTZController();
 	virtual ~UPTZController();
@@ -156,6 +187,28 @@ public:
 	FPTZState GetPTZStateFromUE() const;
 	void SetPTZStateToUE(const FPTZState& PTZState);
 
+	UFUNCTION(BlueprintSetter)
+	void SetPanSpeed(float PanSpeed);
+	UFUNCTION(BlueprintSetter)
+	void SetTiltSpeed(float TiltSpeed);
+	UFUNCTION(BlueprintSetter)
+	void SetZoomSpeed(float ZoomSpeed);
+
+	/**
+		Queues the speed and focus commands received as metadata. They are applied on the next tick, which only
+		applies the latest command of each kind received within the frame.
+	*/
+	void QueuePTZPanTiltSpeed(float PanSpeed, float TiltSpeed);
+	void QueuePTZZoomSpeed(float ZoomSpeed);
+	void QueuePTZFocus(bool AutoMode, float Distance);
+
+	/** Counts a preset command received as metadata, which is applied as it is received */
+	void CountPTZCommand(bool bApplied);
+
+	/** Returns the statistics of the PTZ commands received as metadata */
+	UFUNCTION(BlueprintPure, Category = "NDI IO", META = (DisplayName = "Get PTZ Command Stats"))
+	FPTZCommandStats GetPTZCommandStats() const;
+
 protected:
 	virtual void InitializeComponent() override;
 
@@ -171,4 +224,33 @@ protected:
 		float EasingRemaining { 0 };
 	};
 	FPTZStateInterp PTZStateInterp;
+
+	struct FPendingPTZCommands
+	{
+		bool bPanTiltSpeed { false };
+		float PanSpeed { 0 };
+		float TiltSpeed { 0 };
+
+		bool bZoomSpeed { false };
+		float ZoomSpeed { 0 };
+
+		bool bFocus { false };
+		bool bAutoFocus { true };
+		float FocusDistance { 0 };
+
+		bool HasAny() const
+		{
+			return bPanTiltSpeed || bZoomSpeed || bFocus;
+		}
+	};
+	FPendingPTZCommands PendingCommands;
+
+	FPTZCommandStats CommandStats;
+	double CommandRateWindowStart { 0 };
+	int64 CommandRateWindowCommands { 0 };
+
+private:
+	void ApplyPendingPTZCommands();
+	bool IsPTZInMotion() const;
+	void UpdatePTZTickEnabled();
 };
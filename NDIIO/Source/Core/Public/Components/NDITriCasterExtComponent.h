@@ -54,6 +54,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Receive Metadata From Sender"))
 	void ReceiveMetaDataFromSender(UNDIMediaSender* Sender, FString Data);
 
+	/** Call with the UTF-8 TriCasterExt metadata received from an NDI media sender, which is parsed in place */
+	void ReceiveMetaDataUtf8FromSender(UNDIMediaSender* Sender, const ANSICHAR* Data, int32 Length);
+
 public:
 	UTriCasterExtComponent();
 	virtual ~UTriCasterExtComponent();
@@ -68,24 +71,77 @@ public:
 	void TriCasterExt(AActor* Actor, UObject* Object, FProperty* Property, FString PropertyElementName, FString PropertyValueStr, FTimespan EasingDuration);
 	void TriCasterExtCustom(const FTriCasterExt& TCData);
 
+	/**
+		Sets the named property, of the named actor or one of its components, through a binding which is resolved
+		once and kept until an actor of that name is spawned or destroyed, or a level is streamed in or out.
+		The property is named as 'Property' or 'Property:Field' for a field of a struct property.
+	*/
+	void TriCasterExtProperty(const FString& ActorName, const FString* ComponentName, const FString& PropertyName, const FString& PropertyValueStr, FTimespan EasingDuration);
+
 protected:
 	virtual void InitializeComponent() override;
 
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 protected:
 	TSharedPtr<class NDIXmlParser> NDIMetadataParser;
 
-	struct FTriCasterExtInterp
+	/** A property resolved from the names in the metadata */
+	struct FTriCasterExtBinding
 	{
-		AActor* Actor;
-		UObject* Object;
-		FProperty* Property;
+		FString ActorName;
+
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<UObject> Object;
+		FProperty* Property = nullptr;
 		FString PropertyElementName;
-		FString PropertyValueStr;
-		float EasingDuration;
 
-		float EasingRemaining;
+		/** The field of the struct property named by the element name, if any */
+		FProperty* FieldProperty = nullptr;
+
+		/** The numeric property, or numeric field, which is eased towards its target */
+		FNumericProperty* NumericProperty = nullptr;
+
+		bool bUpdatesComponentTransform = false;
+
+		bool IsResolved() const
+		{
+			return (Property != nullptr) && Object.IsValid() && Actor.IsValid();
+		}
+	};
+	TMap<FString, FTriCasterExtBinding> Bindings;
+
+	struct FTriCasterExtInterp
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<UObject> Object;
+		FProperty* Property = nullptr;
+		FProperty* FieldProperty = nullptr;
+		FNumericProperty* NumericProperty = nullptr;
+		bool bUpdatesComponentTransform = false;
+
+		/** The target value, parsed once: a number for numeric properties, otherwise the text to import */
+		double TargetValue = 0.0;
+		FString ImportText;
+
+		float EasingDuration = 0.0f;
+		float EasingRemaining = 0.0f;
 	};
 	TArray<FTriCasterExtInterp> TriCasterExtInterp;
+
+private:
+	const FTriCasterExtBinding& FindOrResolveBinding(const FString& ActorName, const FString* ComponentName, const FString& PropertyName);
+	void ResolveBinding(FTriCasterExtBinding& Binding, const FString* ComponentName, const FString& PropertyBaseName) const;
+	void AddTriCasterExtInterp(const FTriCasterExtBinding& Binding, const FString& PropertyValueStr, FTimespan EasingDuration);
+
+	void InvalidateBindings(AActor* Actor);
+	void InvalidateAllBindings(ULevel* Level, UWorld* World);
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle ActorDestroyedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
 };
@@ -18,6 +18,7 @@
 #include <Interfaces/IPluginManager.h>
 #include <Modules/ModuleManager.h>
 #include <IMediaPlayerFactory.h>
+#include <Async/Future.h>
 
 #include <NDIIOPluginSettings.h>
 
@@ -43,11 +44,39 @@ public:
 	bool BeginBroadcastingActiveViewport();
 	void StopBroadcastingActiveViewport();
 
+	/** Loads the NDI runtime and starts the plugin services, if that was not done yet. Safe to call from any thread */
+	bool EnsureRuntimeLoaded();
+
+	/** Loads the NDI runtime on first use of the plugin, through the loaded plugin module */
+	static bool EnsureNDIRuntime();
+
 private:
 	bool LoadModuleDependencies();
 	void ShutdownModuleDependencies();
 
+	/** Points the NDI library at the discovery server of the plugin settings, before it is initialized */
+	void ConfigureDiscoveryServer();
+
+	void StartServices();
+	void ReportMissingRuntime();
+
 private:
+	enum class ERuntimeState : uint8
+	{
+		NotLoaded,
+		Loaded,
+		Failed
+	};
+
+	static FNDIIOPluginModule* PluginModule;
+
+	FCriticalSection RuntimeSyncContext;
+	ERuntimeState RuntimeState = ERuntimeState::NotLoaded;
+	bool bAreServicesStarted = false;
+
+	/** The preload of the runtime which was started along with the module */
+	TFuture<void> PreloadFuture;
+
 	TSharedPtr<class FNDIFinderService> NDIFinderService = nullptr;
 	TSharedPtr<class FNDIConnectionService> NDIConnectionService = nullptr;
 
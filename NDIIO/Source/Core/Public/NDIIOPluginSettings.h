@@ -11,6 +11,7 @@
 
 #include <Misc/FrameRate.h>
 #include <UObject/Object.h>
+#include <Structures/NDIDiscoveryScope.h>
 
 #include "NDIIOPluginSettings.generated.h"
 
@@ -49,4 +50,58 @@ public:
 
 	UPROPERTY(Config, EditAnywhere, Category = "NDI IO", META = (DisplayName = "Begin Broadcast On Play"))
 	bool bBeginBroadcastOnPlay = false;
+
+	/**
+		Loads the NDI runtime in the background while the engine starts up, so that sources have already been discovered
+		by the time they are first asked for. When disabled, the runtime is only loaded when the plugin is first used
+	*/
+	UPROPERTY(Config, EditAnywhere, Category = "NDI IO", META = (DisplayName = "Preload Runtime On Startup"))
+	bool bPreloadRuntime = true;
+
+	/**
+		Which sources on the network are discovered. Narrowing the scope to the groups or machines of interest reduces
+		the discovery traffic and the number of sources to handle. Can be changed at runtime through the NDI IO Library
+	*/
+	UPROPERTY(Config, EditAnywhere, Category = "Discovery", META = (DisplayName = "Discovery Scope"))
+	FNDIDiscoveryScope DiscoveryScope;
+
+	/**
+		The address of an NDI discovery server to find sources through, instead of mDNS. This applies to the whole
+		process and takes effect the next time the application is started
+	*/
+	UPROPERTY(Config, EditAnywhere, Category = "Discovery", META = (DisplayName = "Discovery Server"))
+	FString DiscoveryServer;
+
+	/**
+		Remembers the sources found on the network between sessions, so that receivers can connect to a source directly
+		at startup, before discovery has found it again
+	*/
+	UPROPERTY(Config, EditAnywhere, Category = "Discovery", META = (DisplayName = "Cache Network Sources"))
+	bool bCacheNetworkSources = true;
+
+	/** The number of hours after which a source which has not been seen on the network is removed from the cache */
+	UPROPERTY(Config, EditAnywhere, Category = "Discovery",
+			  META = (DisplayName = "Source Cache Expiry (Hours)", ClampMin = "0", EditCondition = "bCacheNetworkSources"))
+	float SourceCacheExpiryHours = 24.f;
+
+	/**
+		The number of sessions in a row in which discovery did not find a cached source again, after which it is removed
+		from the cache, however recently it was seen
+	*/
+	UPROPERTY(Config, EditAnywhere, Category = "Discovery",
+			  META = (DisplayName = "Source Cache Missed Sessions", ClampMin = "1", EditCondition = "bCacheNetworkSources"))
+	int32 SourceCacheMaxMissedSessions = 3;
+
+	/**
+		Keeps the network source of a sender destroyed by level travel alive for a while, repeating the last frame it
+		sent. A sender with the same source name created in that time, such as in the next level, takes the source
+		over, so that receivers stay connected across level travel
+	*/
+	UPROPERTY(Config, EditAnywhere, Category = "Senders", META = (DisplayName = "Keep Senders Across Level Travel"))
+	bool bKeepSendersAcrossLevelTravel = true;
+
+	/** The number of seconds a source is kept alive without a sender, before it is removed from the network */
+	UPROPERTY(Config, EditAnywhere, Category = "Senders",
+			  META = (DisplayName = "Sender Hold Time (Seconds)", ClampMin = "0", EditCondition = "bKeepSendersAcrossLevelTravel"))
+	float SenderHoldTime = 10.f;
 };
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <Kismet/BlueprintFunctionLibrary.h>
 
 #include <Structures/NDIConnectionInformation.h>
+#include <Structures/NDIDiscoveryScope.h>
 #include <Objects/Media/NDIMediaReceiver.h>
 #include <Objects/Media/NDIMediaSender.h>
 
@@ -67,6 +68,25 @@ private:
 												 FNDIConnectionInformation& ConnectionInformation,
 												 FString InSourceName = FString(""));
 
+	/**
+		Retrieves the scope within which the NDI Source Collection is discovered
+
+		@return The groups, extra IP addresses and local sources setting used to discover sources
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NDI IO",
+			  META = (DisplayName = "Get NDI Discovery Scope", AllowPrivateAccess = true))
+	static FNDIDiscoveryScope K2_GetNDIDiscoveryScope();
+
+	/**
+		Changes the scope within which the NDI Source Collection is discovered. The sources are discovered again
+		within the new scope
+
+		@param InScope The groups, extra IP addresses and local sources setting to discover sources with
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO",
+			  META = (DisplayName = "Set NDI Discovery Scope", AllowPrivateAccess = true))
+	static void K2_SetNDIDiscoveryScope(const FNDIDiscoveryScope& InScope);
+
 private:
 	/**
 		Attempts to start broadcasting the active viewport. The output of the active viewport is the current camera
@@ -0,0 +1,84 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Kismet/BlueprintFunctionLibrary.h>
+#include <Structures/NDISenderPerformanceData.h>
+
+#include "NDISenderPerformanceDataLibrary.generated.h"
+
+UCLASS(NotBlueprintable, BlueprintType, Category = "NDI IO",
+	   META = (DisplayName = "NDI Sender Performance Data Library"))
+class NDIIO_API UNDISenderPerformanceDataLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+private:
+	/**
+		Returns a value indicating whether the two structures are comparably equal
+
+		@param A The structure used as the source comparator
+		@param B The structure used as the target comparator
+		@return The resulting value of the comparator operator
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NDI IO",
+			  META = (DisplayName = "Equals (NDI Sender Performance Data)",
+					  CompactNodeTitle = "==", Keywords = "= == Equals", AllowPrivateAccess = true))
+	static bool K2_Compare_NDISenderPerformanceData(FNDISenderPerformanceData A, FNDISenderPerformanceData B)
+	{
+		return A == B;
+	}
+
+	/**
+		Returns a value indicating whether the two structures are NOT comparably equal
+
+		@param A The structure used as the source comparator
+		@param B The structure used as the target comparator
+		@return The resulting value of the comparator operator
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NDI IO",
+			  META = (DisplayName = "Not Equals (NDI Sender Performance Data)",
+					  CompactNodeTitle = "!=", Keywords = "! != Not Equals", AllowPrivateAccess = true))
+	static bool K2_Compare_Not_NDISenderPerformanceData(FNDISenderPerformanceData A, FNDISenderPerformanceData B)
+	{
+		return A != B;
+	}
+
+	/**
+		Resets the structure's properties to their default values
+
+		@param PerformanceData The structure to reset to the default value
+		@return The reference to the passed in structure after the 'reset' has been completed
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO",
+			  META = (DisplayName = "Reset Sender Performance Data", AllowPrivateAccess = true))
+	static UPARAM(ref) FNDISenderPerformanceData& K2_NDISenderPerformanceData_Reset(
+		UPARAM(ref) FNDISenderPerformanceData& PerformanceData)
+	{
+		// call the underlying function to reset the properties of the object
+		PerformanceData.Reset();
+
+		// return the Performance Data object reference
+		return PerformanceData;
+	}
+
+	/**
+		Returns the upper bound of the histogram bucket the given percentile of the samples falls in
+
+		@param Histogram The histogram of the samples
+		@param Percentile The percentile, from 0 to 100
+		@return The value the given percentile of the samples is below
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "NDI IO",
+			  META = (DisplayName = "Get Percentile (NDI Performance Histogram)", AllowPrivateAccess = true))
+	static float K2_NDIPerformanceHistogram_GetPercentile(const FNDIPerformanceHistogram& Histogram, float Percentile)
+	{
+		return Histogram.GetPercentile(Percentile);
+	}
+};
@@ -0,0 +1,117 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <NDIIOPluginAPI.h>
+
+#include <UObject/Object.h>
+#include <Objects/Media/NDIMediaReceiver.h>
+
+#include "NDIMediaReceiveGroup.generated.h"
+
+
+/**
+	Presents the video of several NDI Media Receivers together, choosing for every member the buffered frame
+	whose source time best matches the others.  All members are updated in the same engine frame.
+*/
+UCLASS(BlueprintType, Blueprintable, Category = "NDI IO", META = (DisplayName = "NDI Media Receive Group"))
+class NDIIO_API UNDIMediaReceiveGroup : public UObject
+{
+	GENERATED_BODY()
+
+private:
+	/** The receivers whose video is presented together */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Settings",
+			  META = (DisplayName = "Members", AllowPrivateAccess = true))
+	TArray<UNDIMediaReceiver*> Members;
+
+	/** The number of video frames buffered for every member to find frames with matching source times */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Settings",
+			  META = (DisplayName = "Buffered Frames", ClampMin = "1", ClampMax = "8", AllowPrivateAccess = true))
+	int32 BufferedFrames = 3;
+
+	/** Match frames on the timecode set by the senders, rather than on the time the frames were sent */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Settings",
+			  META = (DisplayName = "Align on Timecode", AllowPrivateAccess = true))
+	bool bAlignOnTimecode = false;
+
+	/** A member which has not received a new frame for this long (in seconds) no longer holds back the others */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Settings",
+			  META = (DisplayName = "Stall Timeout", ClampMin = "0.0", AllowPrivateAccess = true))
+	float StallTimeout = 0.5f;
+
+	/** The largest skew (in milliseconds) between any member and the common source time of the frames presented last */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Maximum Skew (ms)", AllowPrivateAccess = true))
+	float MaximumSkew = 0.f;
+
+public:
+	/**
+		Initializes the members for group use and starts presenting their video frames together
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Start"))
+	void Start();
+
+	/**
+		Stops presenting the video frames of the members
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Stop"))
+	void Stop();
+
+	/**
+		Adds a receiver to the group. The receiver should not have been initialized for standalone use
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Add Member"))
+	void AddMember(UNDIMediaReceiver* Receiver);
+
+	/**
+		Removes a receiver from the group
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Remove Member"))
+	void RemoveMember(UNDIMediaReceiver* Receiver);
+
+	/**
+		Returns how far (in milliseconds) the source time of the frame last presented by 'Receiver' was from the
+		common source time of the group
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Get Member Skew"))
+	float GetMemberSkew(UNDIMediaReceiver* Receiver) const;
+
+	//~ UObject interface
+	virtual void BeginDestroy() override;
+
+private:
+	struct FBufferedFrame
+	{
+		FNDIMediaVideoFramePtr Frame;
+		int64 Time = 0;
+	};
+
+	struct FMemberState
+	{
+		UNDIMediaReceiver* Receiver = nullptr;
+		TArray<FBufferedFrame> Frames;
+		int32 NewestFrame = -1;
+		int32 NumFrames = 0;
+		double LastArrivalTime = 0.0;
+		float Skew = 0.f;
+	};
+
+	void ResetMemberState(FMemberState& MemberState, UNDIMediaReceiver* Receiver) const;
+	void LatchMembers_RenderThread();
+
+private:
+	mutable FCriticalSection GroupSyncContext;
+
+	TArray<FMemberState> MemberStates;
+
+	bool bIsStarted = false;
+
+	TSharedPtr<class FNDILateLatchViewExtension, ESPMode::ThreadSafe> LateLatchViewExtension;
+	FDelegateHandle FrameEndRTHandle;
+};
@@ -17,8 +17,14 @@
 
 #include <Objects/Media/NDIMediaSoundWave.h>
 #include <Objects/Media/NDIMediaTexture2D.h>
+#include <Objects/Media/NDIMediaVideoFrame.h>
 #include <Structures/NDIConnectionInformation.h>
 #include <Structures/NDIReceiverPerformanceData.h>
+#include <Structures/NDIMetadataWriter.h>
+#include <Structures/NDIBinaryMetadata.h>
+#include <Structures/NDITimecode.h>
+
+#include <atomic>
 
 #include "NDIMediaReceiver.generated.h"
 
@@ -38,6 +44,30 @@ namespace NDIMediaOption
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNDIMediaReceiverVideoReceived, UNDIMediaReceiver*, Receiver);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNDIMediaReceiverAudioReceived, UNDIMediaReceiver*, Receiver);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FNDIMediaReceiverMetaDataReceived, UNDIMediaReceiver*, Receiver, FString, Data, bool, bAttachedToVideoFrame);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FNDIMediaReceiverMetaDataElementReceived, UNDIMediaReceiver*, Receiver, FName, ElementName, FString, Data);
+
+
+/**
+	A metadata frame received by an NDI Media Receiver, routed by the name of its root element.  The data stays in
+	the UTF-8 it was received in, and is only decoded when asked for
+*/
+struct NDIIO_API FNDIMetadataElement
+{
+	FName ElementName;
+	int64 Timecode = 0;
+
+	/** The null-terminated UTF-8 data, valid for the duration of the call it was passed to */
+	const ANSICHAR* Data = nullptr;
+	int32 Length = 0;
+
+	/** Decodes the data */
+	FString ToString() const;
+};
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FNDIMetadataElementReceived, class UNDIMediaReceiver*, const FNDIMetadataElement&);
+
+/** Receives the payload version and the payload of a frame of binary metadata, valid for the duration of the call */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FNDIBinaryMetadataReceived, class UNDIMediaReceiver*, uint16, TArrayView<const uint8>);
 
 
 /**
@@ -87,6 +117,29 @@ private:
 			  META = (DisplayName = "Sync Timecode to Source", AllowPrivateAccess = true))
 	bool bSyncTimecodeToSource = true;
 
+	/**
+		Delays the video and audio of the source by this many milliseconds, e.g. to line it up with another device.
+		Can be changed while connected
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, BlueprintSetter = "SetDelay", Category = "Settings",
+			  META = (DisplayName = "Delay (ms)", ClampMin = "0.0", AllowPrivateAccess = true))
+	float Delay = 0.f;
+
+	/**
+		The largest delay (in milliseconds) which can be set, bounding the memory used to hold the delayed frames
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", AdvancedDisplay,
+			  META = (DisplayName = "Maximum Delay (ms)", ClampMin = "0.0", AllowPrivateAccess = true))
+	float MaximumDelay = 2000.f;
+
+	/**
+		The memory (in megabytes) which the delayed video frames may use.  Large frames are delayed by less than
+		requested when the delay needs more
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", AdvancedDisplay,
+			  META = (DisplayName = "Maximum Delay Memory (MB)", ClampMin = "0", AllowPrivateAccess = true))
+	int32 MaximumDelayMemory = 512;
+
 	/**
 		Should perform the sRGB to Linear color space conversion
 	*/
@@ -108,6 +161,63 @@ private:
 			  META = (DisplayName = "Performance Data", AllowPrivateAccess = true))
 	FNDIReceiverPerformanceData PerformanceData;
 
+	/**
+		The amount of GPU memory (in megabytes) used to keep the textures of recently received frame sizes and formats,
+		so that switching between them (e.g. between proxy and full bandwidth) does not recreate them
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", AdvancedDisplay,
+			  META = (DisplayName = "Conversion Cache Size (MB)", ClampMin = "0", AllowPrivateAccess = true))
+	int32 ConversionCacheSize = 128;
+
+	/**
+		The number of times per second the performance of the connection is sampled from the NDI sdk, or 0 to sample it
+		every frame
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", AdvancedDisplay,
+			  META = (DisplayName = "Performance Sampling Rate", ClampMin = "0", Units = "Hz", AllowPrivateAccess = true))
+	float PerformanceSamplingRate = 10.f;
+
+	/**
+		The length, in seconds, of the window the performance histograms are gathered over before they are published
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", AdvancedDisplay,
+			  META = (DisplayName = "Performance Histogram Window", ClampMin = "0.1", Units = "s", AllowPrivateAccess = true))
+	float PerformanceHistogramWindow = 10.f;
+
+	/**
+		Delivers only the latest of the 'On Video Received' events raised during a frame, rather than one for each frame
+		received. The Blueprint events are delivered on the game thread, at the start of the next frame
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", AdvancedDisplay,
+			  META = (DisplayName = "Coalesce Video Received Events", AllowPrivateAccess = true))
+	bool bCoalesceVideoReceivedEvents = false;
+
+	/** Delivers only the latest of the 'On Audio Received' events raised during a frame */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", AdvancedDisplay,
+			  META = (DisplayName = "Coalesce Audio Received Events", AllowPrivateAccess = true))
+	bool bCoalesceAudioReceivedEvents = false;
+
+	/**
+		Delivers only the latest metadata of each root element among the frames delivered during a frame, dropping
+		the earlier metadata. Binary metadata is always delivered in full
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", AdvancedDisplay,
+			  META = (DisplayName = "Latest MetaData Only", AllowPrivateAccess = true))
+	bool bLatestMetaDataOnly = false;
+
+	/**
+		The largest number of metadata frames delivered to the game thread in one engine frame; the frames beyond it wait
+		for the next one. Metadata is captured on a thread of its own, and only the frames which are subscribed to are kept
+	*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", AdvancedDisplay,
+			  META = (DisplayName = "MetaData Frames Per Frame", ClampMin = "1", AllowPrivateAccess = true))
+	int32 MetaDataFramesPerFrame = 64;
+
+	/** The number of metadata frames which can wait to be delivered, before newly received ones are dropped */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings", AdvancedDisplay,
+			  META = (DisplayName = "Max Queued MetaData Frames", ClampMin = "1", AllowPrivateAccess = true))
+	int32 MaxQueuedMetaDataFrames = 1024;
+
 	/**
 		Provides an NDI Video Texture object to render videos frames from the source onto (optional)
 	*/
@@ -137,6 +247,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="NDI Events", META = (DisplayName = "On MetaData Received by Receiver", AllowPrivateAccess = true))
 	FNDIMediaReceiverMetaDataReceived OnReceiverMetaDataReceived;
 
+	/** Receives the metadata of the elements subscribed to through 'Subscribe To MetaData Element' */
+	UPROPERTY(BlueprintAssignable, Category="NDI Events", META = (DisplayName = "On MetaData Element Received by Receiver", AllowPrivateAccess = true))
+	FNDIMediaReceiverMetaDataElementReceived OnReceiverMetaDataElementReceived;
+
 public:
 
 	UNDIMediaReceiver();
@@ -153,7 +267,8 @@ public:
 	enum class EUsage
 	{
 		Standalone,	// The receiver automatically captures its own video frame every engine render frame
-		Controlled	// The user of the receiver manually triggers capturing a frame through CaptureConnectedVideo/Audio()
+		Controlled,	// The user of the receiver manually triggers capturing a frame through CaptureConnectedVideo/Audio()
+		Grouped		// A receive group picks the video frame to display through PresentVideoFrame(), the receiver captures its own metadata
 	};
 	bool Initialize(const FNDIConnectionInformation& InConnectionInformation, EUsage InUsage);
 	bool Initialize(EUsage Inusage);
@@ -182,6 +297,58 @@ public:
 	UFUNCTION(BlueprintSetter)
 	void ChangeVideoTexture(UNDIMediaTexture2D* InVideoTexture = nullptr);
 
+	/**
+		Delivers the metadata frames with the named root element through 'On MetaData Element Received by Receiver'
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Subscribe To MetaData Element"))
+	void SubscribeToMetaDataElement(FName ElementName);
+
+	/**
+		Stops delivering the metadata frames with the named root element to Blueprint
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Unsubscribe From MetaData Element"))
+	void UnsubscribeFromMetaDataElement(FName ElementName);
+
+	/**
+		Calls 'Delegate' on the game thread with the metadata frames whose root element is 'ElementName'
+	*/
+	FDelegateHandle SubscribeToMetadataElement(FName ElementName, FNDIMetadataElementReceived::FDelegate&& Delegate);
+
+	/**
+		Removes a subscription made through 'SubscribeToMetadataElement'
+	*/
+	void UnsubscribeFromMetadataElement(FName ElementName, FDelegateHandle Handle);
+
+	/**
+		Decodes the frames of a channel of binary metadata sent with 'SendBinaryMetadata', and delivers them to
+		the delegate on the game thread. Frames attached to video frames are decoded as well. Delta encoded frames
+		need every frame of the channel, so they are never coalesced by 'Latest MetaData Only'.
+	*/
+	FDelegateHandle SubscribeToBinaryMetadata(FName Channel, FNDIBinaryMetadataReceived::FDelegate&& Delegate);
+
+	/**
+		Removes a subscription made through 'SubscribeToBinaryMetadata'
+	*/
+	void UnsubscribeFromBinaryMetadata(FName Channel, FDelegateHandle Handle);
+
+	/**
+		Sets the delay (in milliseconds) applied to the video and audio of the source
+	*/
+	UFUNCTION(BlueprintSetter)
+	void SetDelay(float InDelay);
+
+	/**
+		Sets the delay applied to the video and audio of the source as a number of frames at the current frame rate
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Set Delay (frames)"))
+	void SetDelayFrames(int32 InFrames);
+
+	/**
+		Returns the delay (in milliseconds) applied to the video and audio of the source
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Get Delay"))
+	float GetDelay() const;
+
 	/**
 		Attempts to generate the pcm data required by the 'AudioWave' object
 	*/
@@ -211,6 +378,10 @@ public:
 	*/
 	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Send Metadata To Sender (Element + Attributes)"))
 	void SendMetadataFrameAttrs(const FString& Element, const TMap<FString,FString>& Attributes);
+	/**
+		This will send the metadata built by the writer to the sender, without converting it
+	*/
+	void SendMetadataFrameUtf8(const FNDIMetadataWriter& Metadata);
 
 	/**
 		This will set the up-stream tally notifications. If no streams are connected, it will automatically
@@ -241,7 +412,55 @@ public:
 	*/
 	bool CaptureConnectedVideo();
 	bool CaptureConnectedAudio();
-	bool CaptureConnectedMetadata();
+
+	/**
+		Subscribes to the video frames captured by this receiver, standalone or grouped.  The frames are delivered as
+		they are received, before any delay is applied, and can be consumed on any thread.  The subscription ends when the returned
+		object is released or passed to 'UnsubscribeVideoFrames'.
+	*/
+	FNDIMediaVideoFrameSubscriptionRef SubscribeVideoFrames(FNDIMediaVideoFrameSubscription::EMode InMode, int32 InCapacity = 4);
+
+	/**
+		Stops delivering video frames to a subscription
+	*/
+	void UnsubscribeVideoFrames(const FNDIMediaVideoFrameSubscriptionRef& InSubscription);
+
+	/**
+		Captures the newest video frame held by the frame-sync, delivering it to the video frame subscriptions if
+		it is new.  The same frame is handed out until a new one arrives.  Returns nullptr if there is no frame.
+	*/
+	FNDIMediaVideoFramePtr CaptureVideoFrame();
+
+	/**
+		Passes a captured video frame through the delay line, and returns the frame to present now.  Returns the
+		frame itself if there is no delay, or nullptr if no frame is old enough yet.
+	*/
+	FNDIMediaVideoFramePtr DelayVideoFrame(const FNDIMediaVideoFrameRef& InFrame);
+
+	/**
+		Updates the frame information from a captured video frame and, if it differs from the last one presented,
+		broadcasts it to interested receivers through the capture event.  Returns true if the frame was new.
+	*/
+	bool PresentVideoFrame(const NDIlib_video_frame_v2_t& video_frame);
+
+	/**
+		Hands the newest video frame held by the frame-sync to 'Visitor' without displaying or broadcasting it.
+		Returns true if a frame was available.  The frame is only valid for the duration of the call.
+	*/
+	bool VisitConnectedVideo(TFunctionRef<void(const NDIlib_video_frame_v2_t&)> Visitor);
+
+	/**
+		Looks at the newest video frame held by the frame-sync without converting or broadcasting it.
+		Returns true if a frame is available, along with its timestamp and frame rate.
+	*/
+	bool PeekConnectedVideo(int64& OutTimestamp, FFrameRate& OutFrameRate);
+
+	/**
+		Blocks the game thread until a video frame with a timestamp other than 'InLastTimestamp' arrives, or for at
+		most 'InTimeout' seconds (e.g. to genlock the engine).  Returns true with the timestamp and frame rate of the
+		newest frame if one arrived.
+	*/
+	bool WaitForConnectedVideo(int64 InLastTimestamp, double InTimeout, int64& OutTimestamp, FFrameRate& OutFrameRate);
 
 	/**
 		Attempts to immediately update the 'VideoTexture' object with the captured video frame
@@ -251,11 +470,21 @@ public:
 private:
 	void SetIsCurrentlyConnected(bool bConnected);
 
+	/**
+		Points both the user supplied and the internal video texture at the converted frame
+	*/
+	void UpdateVideoTextureReferences(const FTextureRHIRef& ConversionTexture);
+
 	/**
 		Attempts to gather the performance metrics of the connection to the remote source
 	*/
 	void GatherPerformanceMetrics();
 
+	/**
+		Returns the receiver and frame-sync instances of the current connection, which stay alive while held
+	*/
+	TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> GetReceiverInstance() const;
+
 public:
 	/**
 		Set whether or not a RGB to Linear conversion is made
@@ -290,7 +519,24 @@ public:
 		Returns the current performance data of the receiver while connected to the source
 	*/
 	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Get Performance Data"))
-	const FNDIReceiverPerformanceData& GetPerformanceData() const;
+	FNDIReceiverPerformanceData GetPerformanceData() const;
+
+	/**
+		Describes the cache of textures used to convert the received frames
+	*/
+	struct FConversionCacheStats
+	{
+		int32 Entries = 0;
+		int64 Bytes = 0;
+		int64 Hits = 0;
+		int64 Misses = 0;
+		int64 Evictions = 0;
+	};
+
+	/**
+		Returns the statistics of the cache of textures used to convert the received frames
+	*/
+	FConversionCacheStats GetConversionCacheStats() const;
 
 	/** Returns a value indicating whether this object is currently connected to the sender source */
 	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Is Currently Connected"))
@@ -312,6 +558,9 @@ private:
 	virtual FString GetUrl() const override;
 
 	FTextureResource* GetVideoTextureResource() const;
+	/** Creates the internal video texture on first use */
+	UNDIMediaTexture2D* GetOrCreateInternalVideoTexture();
+
 	FTextureResource* GetInternalVideoTextureResource() const;
 
 #if WITH_EDITORONLY_DATA
@@ -326,14 +575,45 @@ public:
 
 private:
 	int64_t LastFrameTimestamp = 0;
+
+	/** The performance data is read under its own lock, so that reading it does not wait on the render thread */
+	mutable FCriticalSection PerformanceDataSyncContext;
+
+	/** The histograms of the current window, before they are published. Used under the render sync context */
+	struct FPerformanceWindow
+	{
+		FNDIPerformanceHistogram ArrivalJitter;
+		FNDIPerformanceHistogram Latency;
+		FNDIPerformanceHistogram VideoQueueDepth;
+		FNDIPerformanceHistogram AudioQueueDepth;
+		FNDIPerformanceHistogram DecodedVideoDataRates;
+
+		double StartTime = 0.0;
+	};
+	FPerformanceWindow PerformanceWindow;
+	double LastPerformanceSampleTime = 0.0;
+	int64 DecodedVideoBytes = 0;
+	int64 LastPresentedTicks = 0;
+	int64 LastPresentedTimestamp = 0;
+	std::atomic<double> ConnectedTime { 0.0 };
 	NDIlib_frame_format_type_e LastFrameFormatType = NDIlib_frame_format_type_max;
 
 	bool bIsCurrentlyConnected = false;
 
-	NDIlib_recv_instance_t p_receive_instance = nullptr;
-	NDIlib_framesync_instance_t p_framesync_instance = nullptr;
+	/** Only changed on the game thread, other threads take a reference to 'ReceiverInstance' to call the SDK */
+	std::atomic<NDIlib_recv_instance_t> p_receive_instance { nullptr };
+	std::atomic<NDIlib_framesync_instance_t> p_framesync_instance { nullptr };
+	TSharedPtr<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> ReceiverInstance;
+	mutable FCriticalSection InstanceSyncContext;
+
+	FCriticalSection SubscriptionSyncContext;
+	TArray<TWeakPtr<FNDIMediaVideoFrameSubscription, ESPMode::ThreadSafe>> VideoFrameSubscriptions;
+	FNDIMediaVideoFramePtr LastCapturedVideoFrame;
 
-	FCriticalSection RenderSyncContext;
+	mutable FCriticalSection RenderSyncContext;
+
+	/** Converts the timecodes of the frames to the timecode of the frame rate */
+	FNDITimecodeConverter TimecodeConverter;
 	FCriticalSection AudioSyncContext;
 	FCriticalSection MetadataSyncContext;
 	FCriticalSection ConnectionSyncContext;
@@ -356,6 +636,108 @@ private:
 	};
 	EDrawMode DrawMode = EDrawMode::Invalid;
 
+	/**
+		The source textures and render target used to convert frames of one size and draw mode
+	*/
+	struct FConversionResources
+	{
+		EDrawMode DrawMode = EDrawMode::Invalid;
+		FIntPoint FrameSize = FIntPoint(0, 0);
+		FTexture2DRHIRef SourceTexture;
+		FTexture2DRHIRef SourceAlphaTexture;
+		FPooledRenderTargetDesc RenderTargetDescriptor;
+		TRefCountPtr<IPooledRenderTarget> RenderTarget;
+		int64 SizeInBytes = 0;
+		uint64 LastUseCount = 0;
+	};
+	TArray<FConversionResources> ConversionCache;
+	uint64 ConversionCacheUseCount = 0;
+	FConversionCacheStats ConversionCacheStats;
+
+	bool AcquireConversionResources(FRHICommandListImmediate& RHICmdList, const FIntPoint& SourceSize, const FIntPoint& FrameSize, EDrawMode InDrawMode);
+
+	/**
+		Identifies the frame held by the render target, so that converting the same frame again can be skipped
+	*/
+	struct FConvertedFrameKey
+	{
+		int64_t Timestamp = NDIlib_recv_timestamp_undefined;
+		NDIlib_frame_format_type_e FrameFormatType = NDIlib_frame_format_type_max;
+		NDIlib_FourCC_video_type_e FourCC = NDIlib_FourCC_video_type_max;
+		FIntPoint Size = FIntPoint(0, 0);
+		bool bPerformsRGBtoLinear = false;
+
+		FConvertedFrameKey() = default;
+		FConvertedFrameKey(const NDIlib_video_frame_v2_t& video_frame, bool bInPerformsRGBtoLinear)
+			: Timestamp(video_frame.timestamp)
+			, FrameFormatType(video_frame.frame_format_type)
+			, FourCC(video_frame.FourCC)
+			, Size(video_frame.xres, video_frame.yres)
+			, bPerformsRGBtoLinear(bInPerformsRGBtoLinear)
+		{}
+
+		/** Frames without a timestamp cannot be told apart, so they are always converted */
+		bool IsCacheable() const
+		{
+			return Timestamp != NDIlib_recv_timestamp_undefined;
+		}
+
+		bool operator==(const FConvertedFrameKey& Other) const
+		{
+			return (Timestamp == Other.Timestamp) && (FrameFormatType == Other.FrameFormatType) && (FourCC == Other.FourCC) &&
+				   (Size == Other.Size) && (bPerformsRGBtoLinear == Other.bPerformsRGBtoLinear);
+		}
+	};
+	FConvertedFrameKey LastConvertedFrameKey;
+
 	FDelegateHandle FrameEndRTHandle;
 	FDelegateHandle VideoCaptureEventHandle;
+
+	/**
+		Whether the current connection was made to where the source was last seen in a previous session, rather than
+		where discovery has found it in this one
+	*/
+	bool bIsConnectedFromSourceCache = false;
+	FString ConnectedUrl;
+	FDelegateHandle SourceCollectionDeltaHandle;
+
+	void OnSourceCollectionDelta(const struct FNDISourceCollectionDelta& Delta);
+
+	TSharedPtr<class FNDILateLatchViewExtension, ESPMode::ThreadSafe> LateLatchViewExtension;
+
+	TSharedPtr<class FNDIMediaDelayLine, ESPMode::ThreadSafe> DelayLine;
+
+	/** Captures the metadata of standalone and grouped receivers off the render thread */
+	TSharedPtr<class FNDIMediaMetadataCapture, ESPMode::ThreadSafe> MetadataCapture;
+
+	/** Signals the arrival of video frames to the game thread, started on the first wait. Guarded by the subscription lock */
+	TSharedPtr<class FNDIMediaVideoArrival, ESPMode::ThreadSafe> VideoArrival;
+	TMap<FName, FNDIMetadataElementReceived> MetadataSubscriptions;
+	TSet<FName> BlueprintMetadataSubscriptions;
+	FDelegateHandle BeginFrameHandle;
+
+	void StartMetadataCapture();
+	void StopMetadataCapture();
+
+	/** Delivers the metadata frames which were captured, within the budget of a frame */
+	void DispatchMetadata();
+	void DeliverMetadataFrame(const struct FNDIMediaMetadataFrame& Frame);
+	bool IsMetadataElementSubscribed(FName ElementName) const;
+
+	struct FBinaryMetadataChannel
+	{
+		FNDIBinaryMetadataDecoder Decoder;
+		FNDIBinaryMetadataReceived Subscribers;
+	};
+
+	TMap<FName, TSharedRef<FBinaryMetadataChannel> > BinaryMetadataChannels;
+	FDelegateHandle BinaryMetadataElementHandle;
+
+	/** Whether any channel is subscribed to, read on the render thread to pick binary metadata out of the video frames */
+	std::atomic<bool> bHasBinaryMetadataSubscriptions { false };
+
+	void DeliverBinaryMetadata(UNDIMediaReceiver* Receiver, const FNDIMetadataElement& Element);
+
+	/** Hands the binary metadata elements attached to a video frame to the decoders, on the game thread */
+	void EnqueueAttachedBinaryMetadata(const char* Metadata, int64 Timecode);
 };
\ No newline at end of file
@@ -10,15 +10,21 @@
 #include <NDIIOPluginAPI.h>
 
 #include <RendererInterface.h>
+#include <RenderCommandFence.h>
 #include <UObject/Object.h>
 #include <Misc/FrameRate.h>
 #include <Engine/TextureRenderTarget2D.h>
 #include <Sound/SoundSubmix.h>
 #include <Structures/NDIBroadcastConfiguration.h>
+#include <Structures/NDIMetadataWriter.h>
+#include <Structures/NDIBinaryMetadata.h>
+#include <Structures/NDITimecode.h>
+#include <Structures/NDISenderPerformanceData.h>
 #include <Objects/Media/NDIMediaTexture2D.h>
 #include <BaseMediaSource.h>
 #include <Misc/EngineVersionComparison.h>
 
+#include <atomic>
 #include <string>
 
 #include "NDIMediaSender.generated.h"
@@ -107,7 +113,32 @@ private:
 			  META = (DisplayName = "Perform Linear to sRGB?", AllowPrivateAccess = true))
 	bool bPerformLinearTosRGB = true;
 
+	/**
+		Delivers only the latest metadata received during a frame, dropping the earlier metadata. The Blueprint events
+		are delivered on the game thread, at the start of the next frame
+	*/
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings", AdvancedDisplay,
+			  META = (DisplayName = "Latest MetaData Only", AllowPrivateAccess = true))
+	bool bLatestMetaDataOnly = false;
+
+	/**
+		Sends the frames of binary metadata as the difference to the previous frame of their channel, with a key
+		frame at the interval below, so that receivers which join or miss a frame can pick up the channel again.
+		Frames attached to video frames are always sent as key frames
+	*/
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings", AdvancedDisplay,
+			  META = (DisplayName = "Delta Encode Binary MetaData", AllowPrivateAccess = true))
+	bool bDeltaEncodeBinaryMetaData = true;
+
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category = "Broadcast Settings", AdvancedDisplay,
+			  META = (DisplayName = "Binary MetaData Key Frame Interval", ClampMin = "1", AllowPrivateAccess = true))
+	int32 BinaryMetaDataKeyFrameInterval = 30;
+
 public:
+	/** Receives the UTF-8 metadata as it was received by the sender, on the game thread */
+	DECLARE_EVENT_ThreeParams(FNDIMediaSenderMetadataCaptureEvent, FOnSenderMetadataCaptureEvent,
+	                          UNDIMediaSender*, const ANSICHAR*, int32) FOnSenderMetadataCaptureEvent OnNDISenderMetadataCaptureEvent;
+
 	UPROPERTY()
 	FNDIMediaSenderPropertyChanged OnBroadcastConfigurationChanged;
 
@@ -168,6 +199,18 @@ public:
 	*/
 	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Send Metadata To Receivers (Element + Attributes)"))
 	void SendMetadataFrameAttrs(const FString& Element, const TMap<FString,FString>& Attributes, bool AttachToVideoFrame = true);
+	/**
+		This will send the metadata built by the writer to all receivers, without converting it
+	*/
+	void SendMetadataFrameUtf8(const FNDIMetadataWriter& Metadata, bool AttachToVideoFrame = true);
+	/**
+		This will send the payload to all receivers as the next frame of a channel of binary metadata, which is
+		decoded with 'SubscribeToBinaryMetadata' on the receiver. The payload version is passed on to the receivers,
+		to tell the layout of the payload apart. The frames are sent on their own by default: a receiver only sees
+		the video frames its frame-sync hands out, so frames attached to the video are lost whenever a video frame
+		is skipped, and the delta frames after them can't be decoded until the next key frame.
+	*/
+	void SendBinaryMetadata(FName Channel, uint16 PayloadVersion, TArrayView<const uint8> Payload, bool AttachToVideoFrame = false);
 
 	/**
 		Attempts to change the RenderTarget used in sending video frames over NDI
@@ -207,6 +250,12 @@ public:
 	 */
 	virtual void BeginDestroy() override;
 
+	/**
+		Called to check if the object is ready for FinishDestroy.  The sender is ready once the render thread
+		has released its renderer related materials
+	*/
+	virtual bool IsReadyForFinishDestroy() override;
+
 	/**
 		Set whether or not a RGB to Linear conversion is made
 	*/
@@ -232,13 +281,25 @@ public:
 		return this->FrameRate;
 	}
 
+	/**
+		Returns the current performance data of the sender
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Get Performance Data"))
+	FNDISenderPerformanceData GetPerformanceData() const;
+
+	/**
+		Resets the performance data of the sender
+	*/
+	UFUNCTION(BlueprintCallable, Category = "NDI IO", META = (DisplayName = "Reset Performance Data"))
+	void ResetPerformanceData();
+
 private:
 
 	bool CreateSender();
 
 	/**
 		Attempts to get a metadata frame from the sender.
-		If there is one, the data is broadcast through OnSenderMetaDataReceived.
+		If there is one, the data is broadcast through OnNDISenderMetadataCaptureEvent and OnSenderMetaDataReceived.
 		Returns true if metadata was received, false otherwise.
 	*/
 	bool GetMetadataFrame();
@@ -285,17 +346,32 @@ private:
 	std::atomic<bool> bIsChangingBroadcastSize { false };
 
 	FTimecode LastRenderTime;
+	FNDITimecodeConverter TimecodeConverter;
 
 	FTexture2DRHIRef DefaultVideoTextureRHI;
 
 	TArray<float> SendAudioData;
 
 	NDIlib_video_frame_v2_t NDI_video_frame;
-	NDIlib_send_instance_t p_send_instance = nullptr;
+	std::atomic<NDIlib_send_instance_t> p_send_instance { nullptr };
 
 	FCriticalSection AudioSyncContext;
 	FCriticalSection RenderSyncContext;
 
+	/** Passed once the render thread has released the renderer related materials on shutdown */
+	FRenderCommandFence ShutdownFence;
+
+	/** Updated by the render and audio threads once per frame, under its own lock so that reading it is never held up */
+	mutable FCriticalSection PerformanceDataSyncContext;
+	FNDISenderPerformanceData PerformanceData;
+
+	/** The time the resolve and flush of the last draw took, which is not part of the draw time */
+	uint64 LastResolveCycles = 0;
+
+	FCriticalSection BinaryMetadataSyncContext;
+	TMap<FName, FNDIBinaryMetadataEncoder> BinaryMetadataEncoders;
+	FNDIMetadataWriter BinaryMetadata;
+
 	/**
 		A texture with CPU readback
 	*/
@@ -319,9 +395,13 @@ private:
 
 		void Map(FRHICommandListImmediate& RHICmdList, int32& OutWidth, int32& OutHeight, int32& OutLineStride);
 		void* MappedData() const;
+		bool IsMapped() const;
 		void Unmap(FRHICommandListImmediate& RHICmdList);
 
+		void MoveTo(MappedTexture& Other);
+
 		void AddMetaData(const FString& Data);
+		void AddMetaData(const ANSICHAR* Data, int32 Length);
 		const std::string& GetMetaData() const;
 
 	private:
@@ -352,8 +432,13 @@ private:
 		void Map(FRHICommandListImmediate& RHICmdList, int32& OutWidth, int32& OutHeight, int32& OutLineStride);
 		void Send(FRHICommandListImmediate& RHICmdList, NDIlib_send_instance_t p_send_instance, NDIlib_video_frame_v2_t& p_video_data);
 		void Flush(FRHICommandListImmediate& RHICmdList, NDIlib_send_instance_t p_send_instance);
+		void Unmap(FRHICommandListImmediate& RHICmdList);
+
+		void MoveTo(MappedTextureASyncSender& Other);
+		void CopyLastSentFrame(int32 LineStride, TArray<uint8>& OutData) const;
 
 		void AddMetaData(const FString& Data);
+		void AddMetaData(const ANSICHAR* Data, int32 Length);
 	};
 
 	MappedTextureASyncSender ReadbackTextures;
@@ -0,0 +1,131 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <NDIIOPluginAPI.h>
+
+#include <Misc/FrameRate.h>
+#include <HAL/CriticalSection.h>
+#include <HAL/Event.h>
+
+#include <atomic>
+
+
+/**
+	Owns the NDI receiver instance and the frame-sync created from it.  Both are destroyed once the receiver has
+	moved on to another connection and the last frame captured from them has been released, or earlier when the
+	instance is invalidated on module shutdown.
+*/
+class NDIIO_API FNDIMediaReceiverInstance
+{
+public:
+	FNDIMediaReceiverInstance(NDIlib_recv_instance_t InReceiveInstance, NDIlib_framesync_instance_t InFramesyncInstance);
+	~FNDIMediaReceiverInstance();
+
+	FNDIMediaReceiverInstance(const FNDIMediaReceiverInstance&) = delete;
+	FNDIMediaReceiverInstance& operator=(const FNDIMediaReceiverInstance&) = delete;
+
+	NDIlib_recv_instance_t GetReceiveInstance() const { return p_receive_instance; }
+	NDIlib_framesync_instance_t GetFramesyncInstance() const { return p_framesync_instance; }
+
+	/** Destroys the frame-sync and the receiver now, even though captured frames may still reference them */
+	void Invalidate();
+
+	/** Hands a captured video buffer back to the frame-sync, unless the instance has been invalidated */
+	void FreeVideo(NDIlib_video_frame_v2_t& InFrame);
+
+private:
+	std::atomic<NDIlib_recv_instance_t> p_receive_instance { nullptr };
+	std::atomic<NDIlib_framesync_instance_t> p_framesync_instance { nullptr };
+
+	FCriticalSection InstanceSyncContext;
+	bool bIsInvalidated = false;
+};
+
+
+/**
+	An immutable video frame captured by an NDI Media Receiver.  The pixel data belongs to the NDI SDK and stays
+	valid for as long as a reference to this object is held, on any thread.
+*/
+class NDIIO_API FNDIMediaVideoFrame
+{
+public:
+	FNDIMediaVideoFrame(const TSharedRef<FNDIMediaReceiverInstance, ESPMode::ThreadSafe>& InInstance, const NDIlib_video_frame_v2_t& InFrame);
+	~FNDIMediaVideoFrame();
+
+	FNDIMediaVideoFrame(const FNDIMediaVideoFrame&) = delete;
+	FNDIMediaVideoFrame& operator=(const FNDIMediaVideoFrame&) = delete;
+
+	/** Returns the frame as described by the NDI SDK */
+	const NDIlib_video_frame_v2_t& GetFrame() const { return Frame; }
+
+	const uint8* GetData() const { return Frame.p_data; }
+	int32 GetLineStride() const { return Frame.line_stride_in_bytes; }
+	FIntPoint GetResolution() const { return FIntPoint(Frame.xres, Frame.yres); }
+	FFrameRate GetFrameRate() const { return FFrameRate(Frame.frame_rate_N, Frame.frame_rate_D); }
+	NDIlib_FourCC_video_type_e GetFourCC() const { return Frame.FourCC; }
+	int64 GetTimecode() const { return Frame.timecode; }
+	int64 GetTimestamp() const { return Frame.timestamp; }
+	const ANSICHAR* GetMetadata() const { return Frame.p_metadata; }
+
+private:
+	TSharedRef<FNDIMediaReceiverInstance, ESPMode::ThreadSafe> Instance;
+	NDIlib_video_frame_v2_t Frame;
+};
+
+typedef TSharedRef<const FNDIMediaVideoFrame, ESPMode::ThreadSafe> FNDIMediaVideoFrameRef;
+typedef TSharedPtr<const FNDIMediaVideoFrame, ESPMode::ThreadSafe> FNDIMediaVideoFramePtr;
+
+
+/**
+	A bounded queue of video frames delivered by an NDI Media Receiver, which consumers can drain from any thread
+*/
+class NDIIO_API FNDIMediaVideoFrameSubscription
+{
+public:
+	enum class EMode
+	{
+		LatestOnly,	// Only the most recent frame is kept, older frames which were not taken are released
+		EveryFrame	// Frames are queued up to the capacity, after which new frames are dropped
+	};
+
+	FNDIMediaVideoFrameSubscription(EMode InMode, int32 InCapacity);
+	~FNDIMediaVideoFrameSubscription();
+
+	FNDIMediaVideoFrameSubscription(const FNDIMediaVideoFrameSubscription&) = delete;
+	FNDIMediaVideoFrameSubscription& operator=(const FNDIMediaVideoFrameSubscription&) = delete;
+
+	/** Takes the oldest queued frame. Returns false if there is none */
+	bool Dequeue(FNDIMediaVideoFramePtr& OutFrame);
+
+	/** Waits up to 'WaitTimeMs' milliseconds for a frame to be queued, then takes it. Returns false if there is none */
+	bool WaitAndDequeue(FNDIMediaVideoFramePtr& OutFrame, uint32 WaitTimeMs);
+
+	/** Returns the number of frames currently queued */
+	int32 Num() const;
+
+	/** Returns the number of frames which were not delivered because the queue was full or superseded */
+	int64 GetDroppedFrames() const;
+
+	/** Called by the receiver to deliver a frame */
+	void Enqueue(const FNDIMediaVideoFrameRef& InFrame);
+
+private:
+	const EMode Mode;
+	const int32 Capacity;
+
+	mutable FCriticalSection QueueSyncContext;
+	TArray<FNDIMediaVideoFramePtr> Frames;
+	int32 Head = 0;
+	int32 Count = 0;
+	int64 DroppedFrames = 0;
+
+	FEvent* FrameAvailableEvent = nullptr;
+};
+
+typedef TSharedRef<FNDIMediaVideoFrameSubscription, ESPMode::ThreadSafe> FNDIMediaVideoFrameSubscriptionRef;
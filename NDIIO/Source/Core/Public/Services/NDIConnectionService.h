@@ -76,6 +76,9 @@ private:
 	// Handler for when the render thread frame has ended
 	void OnEndRenderFrame();
 
+	// Creates the texture and sender used to broadcast the active viewport, on first use
+	void CreateActiveViewportSender();
+
 	void BeginAudioCapture();
 	void StopAudioCapture();
 
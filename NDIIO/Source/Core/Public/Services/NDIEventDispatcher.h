@@ -0,0 +1,49 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Containers/Queue.h>
+#include <Templates/Function.h>
+#include <UObject/WeakObjectPtrTemplates.h>
+
+/**
+	Delivers the events which senders and receivers raise on the render, audio and capture threads to the game thread,
+	in one batch at the start of each frame.  Events are queued without locking, and an event queued with a coalescing
+	key replaces the events queued under the same object and key earlier in the frame.
+*/
+class NDIIO_API FNDIEventDispatcher
+{
+public:
+	/** Queues an event raised by 'Owner', which is dropped if the owner is destroyed before the batch is delivered */
+	static void Enqueue(const UObject* Owner, TUniqueFunction<void()>&& InDispatch);
+
+	/** Queues an event raised by 'Owner', of which only the latest under the same 'CoalesceKey' is delivered */
+	static void EnqueueCoalesced(const UObject* Owner, uint32 CoalesceKey, TUniqueFunction<void()>&& InDispatch);
+
+	/** Starts delivering the queued events at the start of each frame */
+	static void Start();
+
+	/** Stops delivering events, and drops those still queued */
+	static void Shutdown();
+
+	/** Delivers the events queued so far. Called on the game thread */
+	static void DispatchEvents();
+
+private:
+	struct FQueuedEvent
+	{
+		TWeakObjectPtr<const UObject> Owner;
+		const UObject* OwnerKey = nullptr;
+		uint32 CoalesceKey = 0;
+		TUniqueFunction<void()> Dispatch;
+	};
+
+	static TQueue<FQueuedEvent, EQueueMode::Mpsc> EventQueue;
+	static FDelegateHandle BeginFrameHandle;
+};
@@ -12,21 +12,89 @@
 #include <HAL/Runnable.h>
 #include <HAL/ThreadSafeBool.h>
 #include <Structures/NDIConnectionInformation.h>
+#include <Structures/NDIDiscoveryScope.h>
 
 /**
-	A Runnable object used for Finding NDI network Sources, and updating interested parties
+	Describes how the collection of network sources changed from one generation to the next
+*/
+struct NDIIO_API FNDISourceCollectionDelta
+{
+	/** The generation of the collection once this change was applied */
+	uint64 Generation = 0;
+
+	/** The sources which were discovered */
+	TArray<FNDIConnectionInformation> Added;
+
+	/** The sources which are no longer available */
+	TArray<FNDIConnectionInformation> Removed;
+
+	/** The sources which are still available, but at another location on the network */
+	TArray<FNDIConnectionInformation> Changed;
+
+	/**
+		Applies this change to a copy of the collection, which is up to date with 'InOutGeneration', without copying
+		the sources which did not change.  A change which the copy already includes is skipped.  Returns false, leaving
+		the copy alone, if a change in between was missed; the copy then has to be updated in full
+	*/
+	bool ApplyTo(TArray<FNDIConnectionInformation>& InOutSources, uint64& InOutGeneration) const;
+};
+
+/**
+	A Runnable object used for Finding NDI network Sources, and updating interested parties.
+
+	The service created by the plugin discovers sources within the scope configured in the plugin settings, and is the
+	one behind the static accessors. Additional services can be created with their own discovery scope, to find
+	sources in other groups or on other sub-nets, and coexist with it.
 */
 class NDIIO_API FNDIFinderService : public FRunnable
 {
 public:
+	/** Constructs the service behind the static accessors, discovering within the scope of the plugin settings */
 	FNDIFinderService();
 
+	/** Constructs an additional service discovering within 'InScope' */
+	explicit FNDIFinderService(const FNDIDiscoveryScope& InScope);
+
+	virtual ~FNDIFinderService();
+
 	// Begin the service
 	virtual bool Start();
 
 	// Stop the service
 	virtual void Shutdown();
 
+public:
+	/** Returns the scope this service discovers sources within */
+	FNDIDiscoveryScope GetScope() const;
+
+	/** Changes the scope this service discovers sources within. The sources are discovered again from scratch */
+	void SetScope(const FNDIDiscoveryScope& InScope);
+
+	/** Get the sources found by this service */
+	TArray<FNDIConnectionInformation> GetSources() const;
+
+	/**
+		Call to update an existing collection of sources to match the sources found by this service, if it was last
+		updated for another generation than the current one. 'InOutGeneration' is set to the current generation
+	*/
+	bool UpdateSources(TArray<FNDIConnectionInformation>& InSourceCollection, uint64& InOutGeneration) const;
+
+	/** Returns the generation of the sources found by this service, which increases every time they change */
+	uint64 GetGeneration() const;
+
+	/** Finds a source found by this service by its name (case insensitive) */
+	bool FindSourceByName(const FString& InSourceName, FNDIConnectionInformation& OutConnectionInformation) const;
+
+	/** Finds a source found by this service by its location on the network */
+	bool FindSourceByUrl(const FString& InUrl, FNDIConnectionInformation& OutConnectionInformation) const;
+
+	/**
+		Event which is triggered with the sources added, removed and changed when the sources found by this service
+		have changed. Deltas are broadcast on the game thread, in order of generation
+	*/
+	DECLARE_EVENT_OneParam(FNDICoreDelegates, FNDISourceCollectionDeltaEvent, const FNDISourceCollectionDelta&)
+	FNDISourceCollectionDeltaEvent& OnSourceCollectionDelta() { return *SourceCollectionDeltaEvent; }
+
 public:
 	/** Get the available sources on the network */
 	static const TArray<FNDIConnectionInformation> GetNetworkSourceCollection();
@@ -34,10 +102,43 @@ public:
 	/** Call to update an existing collection of network sources to match the current collection */
 	static bool UpdateSourceCollection(TArray<FNDIConnectionInformation>& InSourceCollection);
 
+	/**
+		Call to update an existing collection of network sources to match the current collection, if it was last
+		updated for another generation than the current one. 'InOutGeneration' is set to the current generation
+	*/
+	static bool UpdateSourceCollection(TArray<FNDIConnectionInformation>& InSourceCollection, uint64& InOutGeneration);
+
+	/** Returns the generation of the collection of network sources, which increases every time it changes */
+	static uint64 GetNetworkSourceGeneration();
+
+	/** Finds a network source by its name (case insensitive), without copying the collection */
+	static bool FindNetworkSourceByName(const FString& InSourceName, FNDIConnectionInformation& OutConnectionInformation);
+
+	/** Finds a network source by its location on the network, without copying the collection */
+	static bool FindNetworkSourceByUrl(const FString& InUrl, FNDIConnectionInformation& OutConnectionInformation);
+
+	/**
+		Finds the location on the network where a source was last seen, in this or a previous session, so that it can
+		be connected to before discovery has found it. Sources which are currently found take precedence
+	*/
+	static bool FindCachedSourceUrl(const FString& InSourceName, FString& OutUrl);
+
+	/** Returns the discovery scope of the network source collection */
+	static FNDIDiscoveryScope GetNetworkDiscoveryScope();
+
+	/** Changes the discovery scope of the network source collection */
+	static void SetNetworkDiscoveryScope(const FNDIDiscoveryScope& InScope);
+
 	/** Event which is triggered when the collection of network sources has changed */
 	DECLARE_EVENT(FNDICoreDelegates, FNDISourceCollectionChangedEvent)
 	static FNDISourceCollectionChangedEvent EventOnNDISourceCollectionChanged;
 
+	/**
+		Event which is triggered with the sources added, removed and changed when the collection of network sources
+		has changed. Deltas are broadcast on the game thread, in order of generation
+	*/
+	static FNDISourceCollectionDeltaEvent EventOnNDISourceCollectionDelta;
+
 protected:
 	/** FRunnable Interface implementation for 'Init' */
 	virtual bool Init() override;
@@ -49,7 +150,19 @@ protected:
 	virtual uint32 Run() override;
 
 private:
-	bool UpdateNetworkSourceCollection();
+	bool UpdateNetworkSourceCollection(FNDISourceCollectionDelta& OutDelta);
+
+	/** Creates the NDI finder for the current scope, destroying the previous one */
+	void RecreateFindInstance();
+
+	/** Reads the sources seen in previous sessions, leaving out those which have expired */
+	void LoadSourceCache();
+
+	/** Writes the sources seen in this and previous sessions */
+	void SaveSourceCache();
+
+	/** Writes the sources if they changed, at most once every few seconds. Called from the service thread */
+	void SaveSourceCacheIfDirty();
 
 private:
 	bool bShouldWaitOneFrame = true;
@@ -58,5 +171,47 @@ private:
 	FThreadSafeBool bIsThreadRunning;
 	FRunnableThread* p_RunnableThread = nullptr;
 
-	static TArray<FNDIConnectionInformation> NetworkSourceCollection;
-};
\ No newline at end of file
+	/** Whether this is the service behind the static accessors */
+	const bool bIsDefaultService;
+
+	mutable FCriticalSection SyncContext;
+
+	NDIlib_find_instance_t p_find_instance = nullptr;
+
+	FNDIDiscoveryScope Scope;
+	FThreadSafeBool bIsScopeChangePending;
+
+	TArray<FNDIConnectionInformation> NetworkSourceCollection;
+
+	/** Indices into the network source collection, by source name (case insensitive) and by url */
+	TMap<FString, int32> NetworkSourceIndexByName;
+	TMap<FString, int32> NetworkSourceIndexByUrl;
+
+	uint64 NetworkSourceGeneration = 0;
+
+	/** Shared with the broadcasts queued on the game thread, which may outlive this service */
+	TSharedRef<FNDISourceCollectionDeltaEvent, ESPMode::ThreadSafe> SourceCollectionDeltaEvent = MakeShared<FNDISourceCollectionDeltaEvent, ESPMode::ThreadSafe>();
+
+	/**
+		Where a source was last seen, and when (in seconds since the unix epoch), and in how many sessions in a row
+		before this one discovery did not find it
+	*/
+	struct FCachedSource
+	{
+		FString Url;
+		int64 LastSeen = 0;
+		int32 MissedSessions = 0;
+		bool bIsSeenThisSession = true;
+	};
+
+	/** The sources seen in this and previous sessions, by source name (case insensitive) */
+	static TMap<FString, FCachedSource> CachedSources;
+
+	bool bIsSourceCacheEnabled = false;
+	double SourceCacheExpirySeconds = 0.0;
+	int32 SourceCacheMaxMissedSessions = 0;
+
+	/** Whether the sources changed since they were last written, and when that was */
+	bool bIsSourceCacheDirty = false;
+	double LastSourceCacheSaveTime = 0.0;
+};
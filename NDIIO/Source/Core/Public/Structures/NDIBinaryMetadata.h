@@ -0,0 +1,96 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Containers/StringView.h>
+
+#include <NDIIOPluginAPI.h>
+#include <Structures/NDIMetadataWriter.h>
+
+/**
+	Binary metadata is sent as a single element, which stays valid NDI metadata:
+
+		<ndiio_binary channel="Channel">Base64</ndiio_binary>
+
+	The base64 data is a versioned binary layout, with a little-endian header:
+
+		uint8	Format version (1)
+		uint8	Flags (1: delta encoded)
+		uint16	Payload version, chosen by the application for the layout of its payload
+		uint32	Sequence number of the frame within the channel
+		uint32	Size of the payload
+
+	followed by the payload, or when delta encoded, by the payload XORed with the payload of the previous frame
+	of the channel and packed as runs of (zero byte count, literal byte count, literal bytes), counts as varints.
+	A frame is only delta encoded against the frame just before it, and a key frame is sent at regular intervals
+	so that receivers which join, or miss a frame, can pick up the channel again.
+*/
+
+/** The name of the element binary metadata is sent in */
+#define NDIIO_BINARY_METADATA_ELEMENT "ndiio_binary"
+
+/**
+	Encodes the frames of one channel of binary metadata
+*/
+class NDIIO_API FNDIBinaryMetadataEncoder
+{
+public:
+	explicit FNDIBinaryMetadataEncoder(FName InChannel);
+
+	/** Sets whether frames are delta encoded against the previous frame, and how often a key frame is sent */
+	void SetDeltaEncoding(bool bInDeltaEncoding, int32 InKeyFrameInterval);
+
+	/** Sends a key frame next */
+	void Reset();
+
+	/** Writes the payload to the metadata as the next frame of the channel */
+	void Encode(uint16 PayloadVersion, TArrayView<const uint8> Payload, FNDIMetadataWriter& Metadata);
+
+private:
+	TArray<ANSICHAR> Channel;
+
+	bool bDeltaEncoding = true;
+	int32 KeyFrameInterval = 30;
+
+	uint32 Sequence = 0;
+	int32 FramesSinceKeyFrame = 0;
+	bool bHasPreviousPayload = false;
+	uint16 PreviousPayloadVersion = 0;
+	TArray<uint8> PreviousPayload;
+
+	TArray<uint8> Frame;
+};
+
+/**
+	Decodes the frames of one channel of binary metadata
+*/
+class NDIIO_API FNDIBinaryMetadataDecoder
+{
+public:
+	/**
+		Decodes the base64 content of an element into the payload, which is valid until the next frame is decoded.
+		Returns false if the frame is malformed, or is delta encoded against a frame which was not decoded, in
+		which case decoding picks up again at the next key frame.
+	*/
+	bool Decode(FAnsiStringView Encoded, uint16& OutPayloadVersion, TArrayView<const uint8>& OutPayload);
+
+	/** Drops the previous frame, so that decoding starts at the next key frame */
+	void Reset();
+
+	/** Finds the channel and the base64 content of a binary metadata element */
+	static bool ParseElement(FAnsiStringView Xml, FAnsiStringView& OutChannel, FAnsiStringView& OutEncoded);
+
+private:
+	bool bHasPreviousPayload = false;
+	uint32 PreviousSequence = 0;
+	uint16 PreviousPayloadVersion = 0;
+	TArray<uint8> Payload;
+
+	TArray<uint8> Frame;
+};
@@ -0,0 +1,47 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include "NDIDiscoveryScope.generated.h"
+
+/**
+	Describes which sources on the network a finder discovers
+*/
+USTRUCT(BlueprintType, Blueprintable, Category = "NDI IO", META = (DisplayName = "NDI Discovery Scope"))
+struct NDIIO_API FNDIDiscoveryScope
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/** Whether the sources running on this machine are discovered */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Properties", META = (DisplayName = "Show Local Sources"))
+	bool bShowLocalSources = true;
+
+	/** The groups to discover sources in. When empty, the groups configured for NDI on this machine are used */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Properties", META = (DisplayName = "Groups"))
+	TArray<FString> Groups;
+
+	/** Additional IP addresses to query for sources, for machines which are not discoverable on the local sub-net */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Properties", META = (DisplayName = "Extra IPs"))
+	TArray<FString> ExtraIPs;
+
+public:
+	/** Compares this object to 'other' and returns a determination of whether they are equal */
+	bool operator==(const FNDIDiscoveryScope& other) const;
+
+	/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+	bool operator!=(const FNDIDiscoveryScope& other) const;
+
+	/** Returns the groups as the comma separated list expected by NDI, or an empty string for the default groups */
+	FString GetGroupsString() const;
+
+	/** Returns the extra IP addresses as the comma separated list expected by NDI */
+	FString GetExtraIPsString() const;
+};
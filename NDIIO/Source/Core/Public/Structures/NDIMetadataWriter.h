@@ -0,0 +1,117 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Containers/StringView.h>
+
+#include <NDIIOPluginAPI.h>
+
+/**
+	Builds NDI metadata as UTF-8 XML, directly in the buffer which is handed to the NDI sdk.
+
+	The buffer keeps its capacity across Reset, so a writer which is kept and reused for every frame does not
+	allocate once it has grown to the size of the metadata. Small metadata fits the inline buffer and does not
+	allocate at all. Attribute values and text are escaped; numbers are written without going through strings.
+
+		FNDIMetadataWriter Writer;
+		Writer.OpenElement("camera").Attribute("fov", FieldOfView).Attribute("transform", Transform).CloseElement();
+		Sender->SendMetadataFrameUtf8(Writer);
+
+	Vectors, rotators, quaternions and transforms are written as a comma separated list of their components:
+	X,Y,Z for vectors, Pitch,Yaw,Roll for rotators, X,Y,Z,W for quaternions and the translation, rotation
+	quaternion and scale for transforms.
+*/
+class NDIIO_API FNDIMetadataWriter
+{
+public:
+	FNDIMetadataWriter();
+	explicit FNDIMetadataWriter(int32 InitialCapacity);
+
+	/** Clears the metadata, keeping the capacity of the buffer */
+	void Reset();
+
+	FNDIMetadataWriter& OpenElement(FAnsiStringView Name);
+	FNDIMetadataWriter& OpenElement(const ANSICHAR* Name);
+	FNDIMetadataWriter& OpenElement(const FString& Name);
+
+	/** Adds an attribute to the element that was just opened, before any content is added to it */
+	FNDIMetadataWriter& Attribute(FAnsiStringView Name, FAnsiStringView Value);
+	FNDIMetadataWriter& Attribute(FAnsiStringView Name, const ANSICHAR* Value);
+	FNDIMetadataWriter& Attribute(FAnsiStringView Name, const FString& Value);
+	FNDIMetadataWriter& Attribute(FAnsiStringView Name, bool Value);
+	FNDIMetadataWriter& Attribute(FAnsiStringView Name, int32 Value);
+	FNDIMetadataWriter& Attribute(FAnsiStringView Name, int64 Value);
+	FNDIMetadataWriter& Attribute(FAnsiStringView Name, float Value);
+	FNDIMetadataWriter& Attribute(FAnsiStringView Name, double Value);
+	FNDIMetadataWriter& Attribute(FAnsiStringView Name, const FVector& Value);
+	FNDIMetadataWriter& Attribute(FAnsiStringView Name, const FRotator& Value);
+	FNDIMetadataWriter& Attribute(FAnsiStringView Name, const FQuat& Value);
+	FNDIMetadataWriter& Attribute(FAnsiStringView Name, const FTransform& Value);
+
+	/** Adds escaped text to the content of the current element */
+	FNDIMetadataWriter& Text(FAnsiStringView Value);
+	FNDIMetadataWriter& Text(const FString& Value);
+
+	/** Adds the data to the content of the current element, encoded as base64 */
+	FNDIMetadataWriter& Base64(TArrayView<const uint8> Data);
+
+	/** Adds XML to the content of the current element, as it is */
+	FNDIMetadataWriter& Raw(FAnsiStringView Value);
+	FNDIMetadataWriter& Raw(const FString& Value);
+
+	/** Closes the current element, as an empty element if nothing was added to its content */
+	FNDIMetadataWriter& CloseElement();
+
+	/** Returns whether all the opened elements have been closed */
+	bool IsComplete() const
+	{
+		return ElementStack.Num() == 0;
+	}
+
+	/** The metadata, which is always terminated */
+	const ANSICHAR* GetData() const
+	{
+		return Buffer.GetData();
+	}
+
+	/** The length of the metadata, without the terminator */
+	int32 Len() const
+	{
+		return Buffer.Num() - 1;
+	}
+
+	bool IsEmpty() const
+	{
+		return Len() == 0;
+	}
+
+	FAnsiStringView GetView() const
+	{
+		return FAnsiStringView(GetData(), Len());
+	}
+
+	FString ToString() const;
+
+private:
+	void Append(const ANSICHAR* Data, int32 Length);
+	void Append(ANSICHAR Char);
+	void AppendEscaped(FAnsiStringView Value, bool bInAttribute);
+	void AppendNumbers(const double* Values, int32 NumValues);
+	void BeginAttribute(FAnsiStringView Name);
+	void EndAttribute();
+	void BeginContent();
+
+	TArray<ANSICHAR, TInlineAllocator<512> > Buffer;
+
+	/** The offset and length of the names of the opened elements, within the buffer */
+	TArray<TPair<int32, int32>, TInlineAllocator<8> > ElementStack;
+
+	/** Whether the start tag of the current element is still open for attributes */
+	bool bIsStartTagOpen = false;
+};
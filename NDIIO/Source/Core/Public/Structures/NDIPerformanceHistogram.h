@@ -0,0 +1,82 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <NDIIOPluginAPI.h>
+#include <Serialization/Archive.h>
+
+#include "NDIPerformanceHistogram.generated.h"
+
+/**
+	A histogram of the samples of a performance measure, in power of two buckets: the first bucket counts the
+	samples below 1, and bucket N the samples from 2^(N-1) up to 2^N, the last bucket counting all samples above.
+	The buckets are allocated once, so adding a sample is only a few instructions.
+*/
+USTRUCT(BlueprintType, Blueprintable, Category = "NDI IO", META = (DisplayName = "NDI Performance Histogram"))
+struct NDIIO_API FNDIPerformanceHistogram
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	static constexpr int32 NumBuckets = 24;
+
+	/**
+		The number of samples in each bucket
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Buckets"))
+	TArray<int64> Buckets;
+
+	/**
+		The number of samples
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Count"))
+	int64 Count = 0;
+
+	/**
+		The smallest, largest and mean values of the samples
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Min"))
+	float Min = 0.f;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Max"))
+	float Max = 0.f;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Mean"))
+	float Mean = 0.f;
+
+public:
+	/** Constructs a new instance of this object */
+	FNDIPerformanceHistogram();
+
+	/** Compares this object to 'other' and returns a determination of whether they are equal */
+	bool operator==(const FNDIPerformanceHistogram& other) const;
+
+	/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+	bool operator!=(const FNDIPerformanceHistogram& other) const;
+
+public:
+	/** Adds a sample to the histogram */
+	void Add(double Value);
+
+	/** Returns the upper bound of the bucket the given percentile (0 to 100) of the samples falls in */
+	float GetPercentile(float Percentile) const;
+
+	/** Resets the current parameters to the default property values, keeping the buckets allocated */
+	void Reset();
+
+	/** Attempts to serialize this object using an Archive object */
+	FArchive& Serialize(FArchive& Ar);
+
+private:
+	double Sum = 0.0;
+
+	/** Operator override for serializing this object to an Archive object */
+	friend class FArchive& operator<<(FArchive& Ar, FNDIPerformanceHistogram& Input)
+	{
+		return Input.Serialize(Ar);
+	}
+};
@@ -9,6 +9,7 @@
 
 #include <NDIIOPluginAPI.h>
 #include <Serialization/Archive.h>
+#include <Structures/NDIPerformanceHistogram.h>
 
 #include "NDIReceiverPerformanceData.generated.h"
 
@@ -61,6 +62,59 @@ public:
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Video Frames"))
 	int64 VideoFrames = 0;
 
+	/**
+		The number of video, audio and metadata frames waiting in the queues of the receiver
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Queued Video Frames"))
+	int32 QueuedVideoFrames = 0;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Queued Audio Frames"))
+	int32 QueuedAudioFrames = 0;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Queued Metadata Frames"))
+	int32 QueuedMetadataFrames = 0;
+
+	/**
+		The time, in seconds, since the receiver connected to the NDI sender
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Connection Uptime"))
+	float ConnectionUptime = 0.f;
+
+	/**
+		The rate, in megabits per second, of the decoded video frames presented.  This is the size of the
+		uncompressed frames, and not the bitrate of the compressed stream on the network
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Decoded Video Data Rate"))
+	float DecodedVideoDataRate = 0.f;
+
+	/**
+		The variation, in microseconds, between the intervals at which video frames were presented and the intervals
+		between their source timestamps, over the last complete window
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Arrival Jitter"))
+	FNDIPerformanceHistogram ArrivalJitter;
+
+	/**
+		The time, in microseconds, from the source timestamp of the video frames to their presentation, less the delay
+		set on the receiver, over the last complete window. This relies on the clocks of the sender and receiver
+		machines being synchronized.
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Latency"))
+	FNDIPerformanceHistogram Latency;
+
+	/**
+		The sampled depths of the video and audio queues, over the last complete window
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Video Queue Depth"))
+	FNDIPerformanceHistogram VideoQueueDepth;
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Audio Queue Depth"))
+	FNDIPerformanceHistogram AudioQueueDepth;
+
+	/**
+		The sampled decoded video data rates, in megabits per second, over the last complete window
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Decoded Video Data Rates"))
+	FNDIPerformanceHistogram DecodedVideoDataRates;
+
 public:
 	/** Constructs a new instance of this object */
 	FNDIReceiverPerformanceData() = default;
@@ -0,0 +1,153 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <NDIIOPluginAPI.h>
+#include <Serialization/Archive.h>
+#include <Structures/NDIPerformanceHistogram.h>
+
+#include "NDISenderPerformanceData.generated.h"
+
+/**
+	A structure holding data allowing you to determine the current performance levels of the sender, with the
+	number of frames sent and skipped, and how long each stage of sending them took on the thread sending them.
+	The timings are in microseconds.
+*/
+USTRUCT(BlueprintType, Blueprintable, Category = "NDI IO", META = (DisplayName = "NDI Sender Performance Data"))
+struct NDIIO_API FNDISenderPerformanceData
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/**
+		The number of video frames sent to the NDI receivers
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Video Frames"))
+	int64 VideoFrames = 0;
+
+	/**
+		The number of video frames skipped, as no NDI receivers were connected
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Video Frames Skipped Without Connections"))
+	int64 VideoFramesSkippedNoConnections = 0;
+
+	/**
+		The number of video frames skipped, as the frame of the timecode was already sent
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Video Frames Skipped Same Timecode"))
+	int64 VideoFramesSkippedSameTimecode = 0;
+
+	/**
+		The number of video frames skipped, as the size of the broadcast was changing
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Video Frames Skipped Changing Broadcast Size"))
+	int64 VideoFramesSkippedChangingBroadcastSize = 0;
+
+	/**
+		The number of video frames skipped, as there was no render target to draw
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Video Frames Skipped Without Render Target"))
+	int64 VideoFramesSkippedNoRenderTarget = 0;
+
+	/**
+		The number of audio frames sent to the NDI receivers
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Audio Frames"))
+	int64 AudioFrames = 0;
+
+	/**
+		The number of audio frames skipped, as no NDI receivers were connected
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Audio Frames Skipped Without Connections"))
+	int64 AudioFramesSkippedNoConnections = 0;
+
+	/**
+		The number of audio frames skipped, as the size of the broadcast was changing
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Audio Frames Skipped Changing Broadcast Size"))
+	int64 AudioFramesSkippedChangingBroadcastSize = 0;
+
+	/**
+		The number of audio frames skipped, as the sender was busy being reconfigured or shut down
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information",
+			  META = (DisplayName = "Audio Frames Skipped Busy"))
+	int64 AudioFramesSkippedBusy = 0;
+
+	/**
+		The render thread time taken to submit the conversion of the render target, without resolving it.
+		This is CPU submit time; the GPU does the conversion later
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Draw Submit Time"))
+	FNDIPerformanceHistogram DrawTime;
+
+	/**
+		The render thread time taken to submit the resolve of the converted frame into the readback texture, and
+		to flush the commands to the GPU
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Resolve And Flush Time"))
+	FNDIPerformanceHistogram ResolveTime;
+
+	/**
+		The render thread time taken to map the readback texture, which waits for the GPU to have written it
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Map Time"))
+	FNDIPerformanceHistogram MapTime;
+
+	/**
+		The render thread time taken to hand the video frame to the NDI sdk, which sends it asynchronously
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Video Send Time"))
+	FNDIPerformanceHistogram VideoSendTime;
+
+	/**
+		The time taken to convert the interleaved audio for sending
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Audio Convert Time"))
+	FNDIPerformanceHistogram AudioConvertTime;
+
+	/**
+		The time taken to hand the audio frame to the NDI sdk
+	*/
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Information", META = (DisplayName = "Audio Send Time"))
+	FNDIPerformanceHistogram AudioSendTime;
+
+public:
+	/** Constructs a new instance of this object */
+	FNDISenderPerformanceData() = default;
+
+	/** Destructs this object */
+	virtual ~FNDISenderPerformanceData() = default;
+
+	/** Compares this object to 'other' and returns a determination of whether they are equal */
+	bool operator==(const FNDISenderPerformanceData& other) const;
+
+	/** Compares this object to 'other" and returns a determination of whether they are NOT equal */
+	bool operator!=(const FNDISenderPerformanceData& other) const;
+
+public:
+	/** Resets the current parameters to the default property values */
+	void Reset();
+
+protected:
+	/** Attempts to serialize this object using an Archive object */
+	virtual FArchive& Serialize(FArchive& Ar);
+
+private:
+	/** Operator override for serializing this object to an Archive object */
+	friend class FArchive& operator<<(FArchive& Ar, FNDISenderPerformanceData& Input)
+	{
+		return Input.Serialize(Ar);
+	}
+};
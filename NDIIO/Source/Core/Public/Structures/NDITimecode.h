@@ -0,0 +1,70 @@
+/*
+	Copyright (C) 2024 Vizrt NDI AB. All rights reserved.
+
+	This file and its use within a Product is bound by the terms of NDI SDK license that was provided
+	as part of the NDI SDK. For more information, please review the license and the NDI SDK documentation.
+*/
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Misc/Timecode.h>
+#include <Misc/FrameRate.h>
+
+#include <NDIIOPluginAPI.h>
+
+/**
+	Converts NDI timecodes, in 100 ns ticks, to timecodes of a frame rate with integer arithmetic only, so that
+	frame numbers stay exact over the whole day, including drop-frame timecodes.
+
+	The constants of the frame rate are computed when it is set, which does nothing if it did not change, so a
+	converter is meant to be kept and have the frame rate of every frame set on it.
+
+		TimecodeConverter.SetFrameRate(FrameRate);
+		Timecode = TimecodeConverter.FromTicks(video_frame.timecode);
+*/
+class NDIIO_API FNDITimecodeConverter
+{
+public:
+	/** The number of 100 ns ticks in 24 hours, after which timecodes roll over */
+	static constexpr int64 TicksPerDay = 864000000000ll;
+	static constexpr int64 TicksPerSecond = 10000000ll;
+
+	FNDITimecodeConverter();
+	explicit FNDITimecodeConverter(const FFrameRate& InFrameRate);
+
+	void SetFrameRate(const FFrameRate& InFrameRate);
+
+	const FFrameRate& GetFrameRate() const
+	{
+		return FrameRate;
+	}
+
+	/** Whether the timecodes are drop-frame timecodes, as is the case for NTSC rates */
+	bool IsDropFrame() const
+	{
+		return DropFramesPerMinute > 0;
+	}
+
+	/** The number of the frame, within the day, at the time of the ticks */
+	int64 FrameNumberFromTicks(int64 Ticks) const;
+
+	/** The timecode, rolled over at 24 hours, of the frame at the time of the ticks */
+	FTimecode FromTicks(int64 Ticks) const;
+
+	/** The timecode, rolled over at 24 hours, of the frame number */
+	FTimecode FromFrameNumber(int64 FrameNumber) const;
+
+	/** The frame number, within the day, of the timecode */
+	int64 ToFrameNumber(const FTimecode& Timecode) const;
+
+private:
+	FFrameRate FrameRate;
+
+	/** The frames per second counted by the timecode, rounded up for NTSC rates */
+	int64 TimecodeRate = 0;
+	int64 DropFramesPerMinute = 0;
+	int64 FramesPerMinute = 0;
+	int64 FramesPerTenMinutes = 0;
+	int64 FramesPerDay = 0;
+};
@@ -8,15 +8,95 @@
 #pragma once
 
 #include <CoreMinimal.h>
+#include <Containers/StringView.h>
 
 #include <FastXml.h>
 
+/**
+	Hash of an element or attribute name (32-bit FNV-1a over the UTF-8 bytes), which the UTF-8 parser
+	dispatches on. Use NDIXmlHash("name") to get the hash of a literal at compile time.
+*/
+constexpr uint32 NDIXmlHash(const ANSICHAR* Name, int32 Length)
+{
+	uint32 Hash = 2166136261u;
+	for (int32 i = 0; i < Length; ++i)
+	{
+		Hash ^= static_cast<uint8>(Name[i]);
+		Hash *= 16777619u;
+	}
+	return Hash;
+}
+
+template <SIZE_T N>
+constexpr uint32 NDIXmlHash(const ANSICHAR (&Name)[N])
+{
+	return NDIXmlHash(Name, static_cast<int32>(N - 1));
+}
+
+inline uint32 NDIXmlHash(FAnsiStringView Name)
+{
+	return NDIXmlHash(Name.GetData(), Name.Len());
+}
+
+/** Converts a piece of UTF-8 metadata to a string */
+inline FString NDIXmlToString(FAnsiStringView Utf8)
+{
+	FUTF8ToTCHAR Converted(Utf8.GetData(), Utf8.Len());
+	return FString(Converted.Length(), Converted.Get());
+}
+
+/**
+	Attribute values handed out by the UTF-8 parser are always followed by their closing quote or a terminator,
+	so they can be read as numbers in place
+*/
+inline double NDIXmlToDouble(FAnsiStringView Value)
+{
+	return FCStringAnsi::Atod(Value.GetData());
+}
+
+inline int32 NDIXmlToInt(FAnsiStringView Value)
+{
+	return FCStringAnsi::Atoi(Value.GetData());
+}
+
+
 class NDIXmlElementParser
 {
 public:
 	virtual ~NDIXmlElementParser()
 	{}
 
+	/**
+		The UTF-8 versions are called by NDIXmlParser::ParseUtf8, with the names pre-hashed by NDIXmlHash.
+		By default they convert to strings and forward to the versions below, so that parsers which
+		only implement those keep working.
+	*/
+
+	// Start parsing this element
+	virtual bool ProcessOpenUtf8(uint32 ElementHash, FAnsiStringView ElementName)
+	{
+		return ProcessOpen(*NDIXmlToString(ElementName), TEXT(""));
+	}
+
+	// Parse an attribute of this element
+	virtual bool ProcessAttributeUtf8(uint32 AttributeHash, FAnsiStringView AttributeName, FAnsiStringView AttributeValue)
+	{
+		return ProcessAttribute(*NDIXmlToString(AttributeName), *NDIXmlToString(AttributeValue));
+	}
+
+	// Start parsing a sub-element
+	virtual NDIXmlElementParser* ProcessElementUtf8(uint32 ElementHash, FAnsiStringView ElementName)
+	{
+		TSharedRef<NDIXmlElementParser>* ParserPtr = ProcessElement(*NDIXmlToString(ElementName), TEXT(""));
+		return (ParserPtr != nullptr) ? &ParserPtr->Get() : nullptr;
+	}
+
+	// Finish parsing this element
+	virtual bool ProcessCloseUtf8(uint32 ElementHash, FAnsiStringView ElementName)
+	{
+		return ProcessClose(*NDIXmlToString(ElementName));
+	}
+
 	// Start parsing this element
 	virtual bool ProcessOpen(const TCHAR* ElementName, const TCHAR* ElementData)
 	{
@@ -58,8 +138,21 @@ public:
 	void AddElementParser(FName ElementName, TSharedRef<NDIXmlElementParser> ElementParser)
 	{
 		ElementParsers.Add(ElementName, ElementParser);
+
+		FTCHARToUTF8 Utf8Name(*ElementName.ToString());
+		ElementParsersByHash.Add(NDIXmlHash(Utf8Name.Get(), Utf8Name.Length()), ElementParser);
 	}
 
+	/**
+		Parses UTF-8 metadata in place, such as the data of an NDI metadata frame, without going through FFastXml.
+		Element and attribute names are dispatched on their hash, and nothing is allocated unless the elements
+		nest deeper than the inline stack or an attribute value with entities does not fit the inline buffer.
+		Text between the elements is skipped.
+
+		@return false if the metadata is malformed, or a parser stopped the parsing
+	*/
+	bool ParseUtf8(const ANSICHAR* Data, int32 Length);
+
 	virtual bool ProcessXmlDeclaration(const TCHAR* ElementData, int32 XmlFileLineNumber) override
 	{
 		return true;
@@ -127,5 +220,9 @@ protected:
 	TMap<FName, TSharedRef<NDIXmlElementParser> > ElementParsers;
 	TArray<TSharedRef<NDIXmlElementParser> > ElementParserStack;
 
+	TMap<uint32, TSharedRef<NDIXmlElementParser> > ElementParsersByHash;
+	TArray<NDIXmlElementParser*, TInlineAllocator<16> > Utf8ParserStack;
+	TArray<ANSICHAR, TInlineAllocator<256> > Utf8ValueBuffer;
+
 	TSharedRef<NDIXmlElementParser> NullParser { MakeShareable(new NDIXmlElementParser_null()) };
 };
@@ -7,6 +7,7 @@
 
 #include <Widgets/NDIWidgets.h>
 #include <Services/NDIFinderService.h>
+#include <NDIIOPluginModule.h>
 
 #include <DetailLayoutBuilder.h>
 #include <DetailWidgetRow.h>
@@ -192,14 +193,17 @@ public:
 
 	virtual ~SNDISourcesMenu()
 	{
-		FNDIFinderService::EventOnNDISourceCollectionChanged.Remove(SourceCollectionChangedEventHandle);
-		SourceCollectionChangedEventHandle.Reset();
+		FNDIFinderService::EventOnNDISourceCollectionDelta.Remove(SourceCollectionDeltaEventHandle);
+		SourceCollectionDeltaEventHandle.Reset();
 	}
 
 	void Construct(const FArguments& InArgs)
 	{
 		OnSourceClicked = InArgs._OnSourceClicked;
 
+		// Source discovery starts the first time the sources are asked for
+		FNDIIOPluginModule::EnsureNDIRuntime();
+
 		ChildSlot
 		[
 			SNew(SComboButton)
@@ -223,21 +227,28 @@ public:
 
 		UpdateSources = true;
 
-		FNDIFinderService::EventOnNDISourceCollectionChanged.Remove(SourceCollectionChangedEventHandle);
-		SourceCollectionChangedEventHandle.Reset();
-		SourceCollectionChangedEventHandle = FNDIFinderService::EventOnNDISourceCollectionChanged.AddLambda([this]()
+		// The changes are broadcast on the game thread, so they can be applied to the sources straight away
+		FNDIFinderService::EventOnNDISourceCollectionDelta.Remove(SourceCollectionDeltaEventHandle);
+		SourceCollectionDeltaEventHandle.Reset();
+		SourceCollectionDeltaEventHandle = FNDIFinderService::EventOnNDISourceCollectionDelta.AddLambda([this](const FNDISourceCollectionDelta& Delta)
 		{
-			UpdateSources = true;
+			const uint64 PreviousGeneration = SourceGeneration;
+
+			// A change was missed, so start over from the whole collection
+			if (!Delta.ApplyTo(SourceItems, SourceGeneration))
+				UpdateSources = true;
+			else if (SourceGeneration != PreviousGeneration)
+				SourcesChanged = true;
 		});
 	}
 
 	virtual void Tick(const FGeometry& AllottedGeometry, const double CurrentTime, const float DeltaTime) override
 	{
-		bool IsDifferent = false;
+		bool IsDifferent = SourcesChanged.exchange(false);
 
 		if (UpdateSources.exchange(false))
 		{
-			IsDifferent = FNDIFinderService::UpdateSourceCollection(SourceItems);
+			IsDifferent |= FNDIFinderService::UpdateSourceCollection(SourceItems, SourceGeneration);
 		}
 
 		if (SourceItems.Num() == 0)
@@ -317,11 +328,13 @@ protected:
 
 private:
 	TArray<FNDIConnectionInformation> SourceItems;
+	uint64 SourceGeneration = 0;
 	FText SearchingTxt;
 	FNDISourceTreeItem SourceTreeItems;
 
-	FDelegateHandle SourceCollectionChangedEventHandle;
+	FDelegateHandle SourceCollectionDeltaEventHandle;
 	std::atomic_bool UpdateSources { false };
+	std::atomic_bool SourcesChanged { false };
 
 	FOnSourceClicked OnSourceClicked;
 };